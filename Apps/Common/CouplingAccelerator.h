@@ -0,0 +1,98 @@
+// $Id$
+//==============================================================================
+//!
+//! \file CouplingAccelerator.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Acceleration of fixed-point iterations between coupled simulators.
+//!
+//==============================================================================
+
+#ifndef _COUPLING_ACCELERATOR_H
+#define _COUPLING_ACCELERATOR_H
+
+#include "MatVec.h"
+#include <deque>
+
+
+/*!
+  \brief Acceleration of fixed-point iterations between coupled simulators.
+
+  \details This class relaxes the interface field \b x of a partitioned
+  (staggered) solution procedure, where one sweep through the sub-problems
+  is viewed as the fixed-point mapping \b x&tilde; = \b H(\b x).
+  With the residual \b r<sub>k</sub> = \b x&tilde;<sub>k</sub> -
+  \b x<sub>k</sub>, the following update methods are available:
+  - CONSTANT: \b x<sub>k+1</sub> = \b x<sub>k</sub> + &omega; \b r<sub>k</sub>
+  - AITKEN: As CONSTANT, but with a dynamic relaxation factor
+    &omega;<sub>k</sub> = -&omega;<sub>k-1</sub>
+    \b r<sub>k-1</sub>&sdot;&Delta;\b r / |&Delta;\b r|<sup>2</sup>
+  - IQNILS: Interface quasi-Newton with an inverse Jacobian approximation from
+    a least-squares model, \b x<sub>k+1</sub> = \b x&tilde;<sub>k</sub> +
+    \b W \b c, where \b c minimizes |\b V \b c + \b r<sub>k</sub>|.
+    The columns of \b V and \b W are the differences between consecutive
+    residuals and fixed-point outputs, respectively.
+    The columns from a given number of previous time steps may be reused.
+*/
+
+class CouplingAccelerator
+{
+public:
+  //! \brief Enum defining the available relaxation methods.
+  enum Method { NONE, CONSTANT, AITKEN, IQNILS };
+
+  //! \brief The constructor initializes the relaxation parameters.
+  //! \param[in] m The relaxation method to use
+  //! \param[in] omega Initial (or constant) relaxation factor
+  //! \param[in] reuse Number of previous time steps to reuse (IQN-ILS only)
+  explicit CouplingAccelerator(Method m = NONE, double omega = 0.5,
+                               int reuse = 0);
+
+  //! \brief Returns the relaxation method.
+  Method getMethod() const { return method; }
+  //! \brief Returns the current relaxation factor (for AITKEN only).
+  double getOmega() const { return omegaK; }
+  //! \brief Returns the number of secant columns (for IQNILS only).
+  size_t size() const { return cols.size(); }
+
+  //! \brief Initializes the iterations of a new time step.
+  //! \param[in] x0 The interface field entering the first iteration
+  void initStep(const Vector& x0);
+
+  //! \brief Computes the input interface field of the next iteration.
+  //! \param x The fixed-point output on input, the relaxed field on output
+  //! \return The L2-norm of the fixed-point residual
+  double relax(Vector& x);
+
+private:
+  //! \brief Computes the IQN-ILS update from the secant columns.
+  //! \param[in] r The current residual
+  //! \param x The fixed-point output on input, the new field on output
+  //! \return \e false if no secant information is available
+  bool leastSquares(const Vector& r, Vector& x) const;
+
+  //! \brief Secant columns of \b V and \b W.
+  struct Column
+  {
+    Vector v; //!< Residual difference
+    Vector w; //!< Fixed-point output difference
+  };
+
+  Method method; //!< The relaxation method
+  double omega0; //!< Initial (or constant) relaxation factor
+  double omegaK; //!< Current relaxation factor
+  int    nReuse; //!< Number of previous time steps to reuse
+
+  std::deque<Column> cols;  //!< Secant columns, newest first
+  std::deque<size_t> nCols; //!< Number of columns per step, newest first
+
+  bool   first; //!< If \e true, the next iteration is the first of the step
+  Vector xK;    //!< Input field of current iteration
+  Vector rPrev; //!< Residual of previous iteration
+  Vector xPrev; //!< Fixed-point output of previous iteration
+};
+
+#endif
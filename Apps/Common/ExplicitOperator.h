@@ -0,0 +1,136 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ExplicitOperator.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Cached spatial operator for linear explicit time integration.
+//!
+//==============================================================================
+
+#ifndef _EXPLICIT_OPERATOR_H
+#define _EXPLICIT_OPERATOR_H
+
+#include "IntegrandBase.h"
+#include "TimeDomain.h"
+
+class SAM;
+class SystemMatrix;
+class SystemVector;
+
+
+namespace TimeIntegration
+{
+  /*!
+    \brief Cached spatial operator for linear explicit time integration.
+
+    \details For a linear semi-discrete system
+    \b M d\b u/dt = \b f - \b K \b u, the right-hand-side of each stage of
+    an explicit scheme is evaluated as a sparse matrix-vector product with the
+    cached operator \b K, instead of re-assembling it through the element loop.
+    The load vector \b f includes the contributions from the prescribed DOFs,
+    and is either cached as well, or re-assembled by the simulator when the
+    source terms are time-dependent.
+
+    The operator \b K is assembled once by the simulator in the
+    SIM::STIFF_ONLY mode, whereas the mass matrix \b M and the load vector
+    \b f are assembled once in the ordinary solution mode, using a zero state
+    with the current Dirichlet values only. The mass matrix is kept in the
+    equation system of the simulator, such that its factorization is reused.
+
+    The contributions from the prescribed DOFs to \b f depend on the current
+    Dirichlet values. If these are time-dependent, the load vector is
+    therefore re-assembled in each stage, as for time-dependent sources.
+  */
+
+  class ExplicitOperator
+  {
+  public:
+    //! \brief The constructor initializes the pointers.
+    ExplicitOperator() : K(nullptr), f(nullptr), timeDepLoad(false) {}
+    //! \brief Disable copy constructor.
+    ExplicitOperator(const ExplicitOperator&) = delete;
+    //! \brief The destructor frees the cached operator and load vector.
+    ~ExplicitOperator() { this->clear(); }
+
+    //! \brief Frees the cached operator and load vector.
+    void clear();
+    //! \brief Frees the cached data and defines whether the loads vary in time.
+    void reset(bool timeDependentLoad)
+    {
+      this->clear();
+      timeDepLoad = timeDependentLoad;
+    }
+
+    //! \brief Defines the operator matrix. The object takes the ownership.
+    void setOperator(SystemMatrix* K);
+    //! \brief Defines the load vector. The object takes the ownership.
+    void setLoad(SystemVector* f);
+
+    //! \brief Returns \e true if the operator matrix has been defined.
+    bool haveOperator() const { return K != nullptr; }
+
+    //! \brief Evaluates the right-hand-side vector of the simulator.
+    //! \details The operator is assembled in the first call.
+    //! Thereafter, the element loop is only invoked for time-dependent loads
+    //! or Dirichlet conditions.
+    //! \param solver The simulator to evaluate the right-hand-side for
+    //! \param[in] time Time domain of the current stage
+    //! \param[in] u Solution vector of the current stage
+    template<class Solver>
+    bool evaluate(Solver& solver, const TimeDomain& time, const Vector& u)
+    {
+      if (!K)
+      {
+        // The Dirichlet lifting of the load vector cannot be cached
+        // if the prescribed values vary in time
+        if (solver.hasTimeDependentDirichlet())
+          timeDepLoad = true;
+
+        // Zero state with the current Dirichlet values only
+        Vector u0(u.size());
+        solver.applyDirichlet(u0);
+
+        SIM::SolutionMode mode = solver.getProblem()->getMode();
+        if (!solver.setMode(SIM::STIFF_ONLY) ||
+            !solver.assembleSystem(time,Vectors(1,u0)))
+          return false;
+        this->setOperator(solver.getLHSmatrix(0,true));
+
+        if (!solver.setMode(mode) ||
+            !solver.assembleSystem(time,Vectors(1,u0)))
+          return false;
+        if (!timeDepLoad)
+          this->setLoad(solver.getRHSvector(0,true));
+
+        solver.setMode(SIM::RHS_ONLY);
+      }
+      else if (timeDepLoad)
+      {
+        Vector u0(u.size());
+        solver.applyDirichlet(u0);
+        if (!solver.assembleSystem(time,Vectors(1,u0),false))
+          return false;
+      }
+
+      return this->apply(*solver.getSAM(),u,*solver.getRHSvector(0));
+    }
+
+    //! \brief Evaluates the right-hand-side vector \b b = \b f - \b K \b u.
+    //! \param[in] sam Assembly data mapping DOFs to equation numbers
+    //! \param[in] u Solution vector in DOF-order
+    //! \param b Right-hand-side vector in equation order.
+    //! If no load vector is cached, \b b contains the load vector on input.
+    bool apply(const SAM& sam, const Vector& u, SystemVector& b) const;
+
+  private:
+    SystemMatrix* K; //!< The spatial operator
+    SystemVector* f; //!< The load vector
+    bool timeDepLoad; //!< If \e true, the load vector is re-assembled
+  };
+}
+
+#endif
@@ -16,10 +16,17 @@
 
 #include "SIMCoupled.h"
 #include "SIMenums.h"
+#include "CouplingAccelerator.h"
+#include "Utilities.h"
+#include "tinyxml.h"
+#include <cstring>
 
 
 /*!
   \brief Template class for semi-implicitly coupled simulators.
+  \details The staggering iterations may be accelerated by relaxation of an
+  interface field, which is computed by the last simulator of each sweep and
+  which the first simulator depends on.
 */
 
 template<class T1, class T2>
@@ -37,6 +44,71 @@ public:
     maxIter = enable ? std::min(this->S1.getMaxit(),this->S2.getMaxit()) : 0;
   }
 
+  //! \brief Enables relaxation of the staggering iterations.
+  //! \param[in] field Name of the interface field to relax
+  //! \param[in] method The relaxation method to use
+  //! \param[in] omega Initial (or constant) relaxation factor
+  //! \param[in] reuse Number of previous time steps to reuse (IQN-ILS only)
+  void setRelaxation(const std::string& field,
+                     CouplingAccelerator::Method method,
+                     double omega = 0.5, int reuse = 0)
+  {
+    relaxField = field;
+    accel = CouplingAccelerator(method,omega,reuse);
+  }
+
+  //! \brief Parses the relaxation of the staggering iterations.
+  //! \details The relaxation is defined by the \a relaxation child of the
+  //! \a coupling element, e.g.,
+  //! <tt>\<relaxation field="u" type="aitken" omega="0.5"/\></tt>.
+  //! Valid types are \a constant, \a aitken and \a iqnils, where the latter
+  //! also takes the attribute \a reuse. Other elements are ignored.
+  virtual bool parse(const TiXmlElement* elem)
+  {
+    if (strcasecmp(elem->Value(),"coupling"))
+      return true;
+
+    const TiXmlElement* child = elem->FirstChildElement("relaxation");
+    if (!child)
+      return true;
+
+    std::string field, type("aitken");
+    double omega = 0.5;
+    int reuse = 0;
+    utl::getAttribute(child,"field",field);
+    utl::getAttribute(child,"type",type,true);
+    utl::getAttribute(child,"omega",omega);
+    utl::getAttribute(child,"reuse",reuse);
+    if (field.empty())
+    {
+      std::cerr <<" *** SIMCoupledSI::parse: No field to relax."<< std::endl;
+      return false;
+    }
+
+    CouplingAccelerator::Method method;
+    if (type == "constant")
+      method = CouplingAccelerator::CONSTANT;
+    else if (type == "aitken")
+      method = CouplingAccelerator::AITKEN;
+    else if (type == "iqnils" || type == "iqn-ils")
+      method = CouplingAccelerator::IQNILS;
+    else
+    {
+      std::cerr <<" *** SIMCoupledSI::parse: Invalid relaxation type \""
+                << type <<"\"."<< std::endl;
+      return false;
+    }
+
+    utl::LogStream& os = this->S1.getProcessAdm().cout;
+    os <<"\tRelaxation of field \""<< field <<"\": "<< type <<" omega="<< omega;
+    if (method == CouplingAccelerator::IQNILS)
+      os <<" reuse="<< reuse;
+    os << std::endl;
+
+    this->setRelaxation(field,method,omega,reuse);
+    return true;
+  }
+
   //! \brief Computes the solution for the current time step.
   virtual bool solveStep(TimeStep& tp, bool firstS1 = true)
   {
@@ -47,6 +119,21 @@ public:
       this->S1.getProcessAdm().cout <<"\n  step="<< tp.step
                                     <<"  time="<< tp.time.t << std::endl;
 
+    // The interface field to relax is computed by the last simulator
+    utl::vector<double>* x = nullptr;
+    if (accel.getMethod() != CouplingAccelerator::NONE)
+    {
+      if (firstS1)
+        x = this->S2.getField(relaxField);
+      else
+        x = this->S1.getField(relaxField);
+      if (x)
+        accel.initStep(*x);
+      else
+        std::cerr <<"  ** SIMCoupledSI::solveStep: No field \""<< relaxField
+                  <<"\" to relax, ignored."<< std::endl;
+    }
+
     SIM::ConvStatus conv = SIM::OK;
     for (tp.iter = 0; tp.iter <= maxIter && conv != SIM::CONVERGED; tp.iter++)
     {
@@ -62,6 +149,11 @@ public:
 
       if ((conv = this->checkConvergence(tp,status1,status2)) <= SIM::DIVERGED)
         return false;
+
+      // No relaxation after the last iteration, the fixed-point output
+      // is then kept as the (unconverged) solution of this time step
+      if (x && conv != SIM::CONVERGED && tp.iter < maxIter)
+        accel.relax(*x);
     }
 
     this->S1.postSolve(tp);
@@ -90,6 +182,9 @@ public:
 
 protected:
   int maxIter; //!< Maximum number of iterations
+
+  CouplingAccelerator accel; //!< Relaxation of the staggering iterations
+  std::string relaxField;    //!< Name of the interface field to relax
 };
 
 #endif
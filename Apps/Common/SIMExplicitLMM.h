@@ -15,6 +15,7 @@
 
 #include "SystemMatrix.h"
 #include "SIMenums.h"
+#include "ExplicitOperator.h"
 #include "TimeIntUtils.h"
 #include "TimeStep.h"
 
@@ -68,8 +69,13 @@ public:
 
     TimeDomain time(tp.time);
     time.t = tp.time.t - tp.time.dt;
-    if (!solver.assembleSystem(time, Vectors(1, solver.getSolution(1)),
-                               !linear || (tp.step == 1)))
+    if (reuseOp) {
+      // Au + f is evaluated using the cached operator
+      if (!oper.evaluate(solver, time, solver.getSolution(1)))
+        return false;
+    }
+    else if (!solver.assembleSystem(time, Vectors(1, solver.getSolution(1)),
+                                    !linear || (tp.step == 1)))
       return false;
 
     loads[0] = solver.getRHSvector(0, true);
@@ -118,7 +124,12 @@ public:
         if (solver.hasIC(str.str())) {
           TimeDomain time(tp.time);
           time.t = tp.time.t - j*tp.time.dt;
-          if (!solver.assembleSystem(time, Vectors(1, solver.getSolution(j-1))))
+          if (reuseOp) {
+            if (!oper.evaluate(solver, time, solver.getSolution(j-1)))
+              return false;
+          }
+          else if (!solver.assembleSystem(time,
+                                          Vectors(1, solver.getSolution(j-1))))
             return false;
 
           loads[j-2] = solver.getRHSvector(0, true);
@@ -171,6 +182,19 @@ public:
   //! \brief Mark operator as linear to avoid repeated assembly and factorization.
   void setLinear(bool enable) { linear = enable; }
 
+  //! \brief Enables reuse of the assembled spatial operator.
+  //! \details The operator and mass matrix are then assembled once only,
+  //! and the right-hand-side of each step is evaluated as a matrix-vector
+  //! product. This implies a linear operator, see ExplicitOperator.
+  //! \param[in] enable If \e true, enable the operator reuse mode
+  //! \param[in] timeDepLoad If \e true, the loads are re-assembled each step
+  void setOperatorReuse(bool enable, bool timeDepLoad = false)
+  {
+    reuseOp = enable;
+    if (enable) linear = true;
+    oper.reset(timeDepLoad);
+  }
+
 protected:
   Solver& solver; //!< Reference to simulator
   std::vector<SystemVector*> loads; //!< Unscaled load vectors
@@ -179,6 +203,8 @@ protected:
   const std::string fieldName; //!< Name of primary solution fields (for ICs)
   bool hasICs = false; //!< If true, start with full order
   bool linear = false; //!< If true, mass matrix is constant
+  bool reuseOp = false; //!< If true, the spatial operator is reused
+  ExplicitOperator oper; //!< Cached spatial operator
 };
 
 }
@@ -14,6 +14,7 @@
 #define SIM_EXPLICIT_RK_H_
 
 #include "SIMenums.h"
+#include "ExplicitOperator.h"
 #include "TimeIntUtils.h"
 #include "TimeStep.h"
 
@@ -110,8 +111,13 @@ public:
       time.t = tp.time.t+tp.time.dt*(RK.c[i]-1.0);
       solver.updateDirichlet(time.t, &dum);
       solver.applyDirichlet(tmp);
-      if (!solver.assembleSystem(time, Vectors(1, tmp),
-                                 !linear || (tp.step == 1 && i == 0)))
+      if (reuseOp) {
+        // Au + f is evaluated using the cached operator
+        if (!oper.evaluate(solver, time, tmp))
+          return false;
+      }
+      else if (!solver.assembleSystem(time, Vectors(1, tmp),
+                                      !linear || (tp.step == 1 && i == 0)))
         return false;
 
       // solve Mu = Au + f
@@ -176,11 +182,26 @@ public:
   //! \brief Mark operator as linear to avoid repeated assembly and factorization.
   void setLinear(bool enable) { linear = enable; }
 
+  //! \brief Enables reuse of the assembled spatial operator.
+  //! \details The operator and mass matrix are then assembled once only,
+  //! and the right-hand-side of each stage is evaluated as a matrix-vector
+  //! product. This implies a linear operator, see ExplicitOperator.
+  //! \param[in] enable If \e true, enable the operator reuse mode
+  //! \param[in] timeDepLoad If \e true, the loads are re-assembled each stage
+  void setOperatorReuse(bool enable, bool timeDepLoad = false)
+  {
+    reuseOp = enable;
+    if (enable) linear = true;
+    oper.reset(timeDepLoad);
+  }
+
 protected:
   Solver& solver; //!< Reference to simulator
   RKTableaux RK;  //!< Tableaux of Runge-Kutta coefficients
   bool alone; //!< If true, this is a standalone solver
   bool linear = false; //!< If true mass matrix is constant
+  bool reuseOp = false; //!< If true, the spatial operator is reused
+  ExplicitOperator oper; //!< Cached spatial operator
 };
 
 }
@@ -27,6 +27,7 @@ typedef std::set<MPC*,MPCLess> MPCSet;  //!< Sorted set of MPC equations
 typedef MPCSet::const_iterator MPCIter; //!< Iterator over an MPC equation set
 
 struct TimeDomain;
+struct G2Patch;
 class ElementBlock;
 class Field;
 class Fields;
@@ -115,6 +116,11 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream& is) = 0;
+  //! \brief Creates an instance from the given binary patch data.
+  //! \details This default implementation writes the patch in g2 format to
+  //! a temporary string stream, and reads it back using read().
+  //! Sub-classes should override it, to create the spline object directly.
+  virtual bool readBinary(const G2Patch& patch);
   //! \brief Writes the geometry/basis of the patch to the given stream.
   virtual bool write(std::ostream& os, int basis = 0) const = 0;
 
@@ -210,6 +216,11 @@ public:
   //! \brief Returns the classification of a node.
   //! \param[in] inod 1-based node index local to current patch
   virtual char getNodeType(size_t inod) const;
+  //! \brief Returns the element-internal nodes of this patch.
+  //! \param[out] nodes 1-based node indices local to current patch
+  //! \details These are the nodes which are connected to one element only,
+  //! and whose DOFs therefore may be statically condensed.
+  virtual void getInternalNodes(IntVec& nodes) const { nodes.clear(); }
   //! \brief Returns \e true if node \a n is a Lagrange multiplier node.
   bool isLMn(size_t n) const { return n >= myLMs.first && n <= myLMs.second; }
   //! \brief Returns the type of a Lagrange multiplier node.
@@ -390,7 +401,8 @@ public:
   //! \param[in] allMPCs All multi-point constraint equations in the model
   //! \param[in] model All spline patches in the model
   //! \param[in] setPtrOnly If \e true, only set pointer to next MPC in chain
-  static void resolveMPCchains(const MPCSet& allMPCs,
+  //! \return \e false if cyclic chains were detected, otherwise \e true
+  static bool resolveMPCchains(const MPCSet& allMPCs,
                                const ASMVec& model, bool setPtrOnly = false);
 
   //! \brief Initializes the multi-point constraint coefficients.
@@ -490,6 +502,10 @@ public:
   //! \param[in] param The parameters of the point in the knot-span domain
   //! \return Local element number within the patch that contains the point
   virtual int findElementContaining(const double* param) const = 0;
+  //! \brief Evaluates the geometry mapping and its parametric derivatives.
+  //! \return \e false if not available for this patch type
+  virtual bool evalGeometry(const double*, Vec3&, Matrix&) const
+  { return false; }
 
   //! \brief Creates a standard FE model of this patch for visualization.
   //! \param[out] grid The generated finite element grid
@@ -603,6 +619,9 @@ public:
   virtual bool globalL2projection(Matrix& sField,
 				  const IntegrandBase& integrand,
 				  bool continuous = false) const;
+  //! \brief Checks if a valid factorized L2-projection matrix is cached.
+  //! \param[in] continuous If \e true, a continuous L2-projection is used
+  bool hasCachedL2matrix(bool continuous = false) const;
 
   //! \brief Projects the secondary solution using a continuous global L2-fit.
   //! \param[out] sField Secondary solution field control point values
@@ -634,8 +653,18 @@ public:
   bool L2projection(const std::vector<Matrix*>& fVals,
                     const std::vector<FunctionBase*>& function, double t = 0.0);
 
+  //! \brief Returns the 1D operators of a box-shaped patch.
+  //! \details This is implemented by the structured spline patches only,
+  //! see ASMs2D::getTensorOperators() and ASMs3D::getTensorOperators().
+  virtual bool getTensorOperators(Matrices&, Matrices&, int = 1) const
+  { return false; }
+
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const { return this->getNoNodes(1); }
+  //! \brief Appends the knot values of the projection basis to an array.
+  //! \details Used to identify the projection basis in getL2key().
+  //! This version does nothing, for patches without knot vectors.
+  virtual void getProjectionKnots(RealArray&) const {}
 
   //! \brief Returns the number of nodes on refinement basis for this patch.
   virtual size_t getNoRefineNodes() const { return this->getNoNodes(1); }
@@ -760,9 +789,17 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const = 0;
+                                  bool continuous, bool newLHS) const = 0;
+
+  //! \brief Returns a key identifying the current L2-projection matrix.
+  //! \details The key depends on the knots of the projection basis, the
+  //! quadrature scheme and the control point coordinates of this patch,
+  //! such that it changes when a cached projection matrix is no longer valid.
+  //! \param[in] continuous If \e false, a discrete L2-projection is used
+  size_t getL2key(bool continuous) const;
 
 public:
 
@@ -818,6 +855,8 @@ public:
 
   static double modelSize; //!< Characteristic model size
 
+  static bool cacheL2; //!< If \e true, keep the factorized L2-projection matrix
+
   size_t idx; //!< Index of this patch in the multi-patch model
 
 protected:
@@ -864,6 +903,9 @@ protected:
 
   ASMVec neighbors; //!< Patches having nodes in common with this one
 
+  mutable SparseMatrix* L2mat; //!< Cached factorized L2-projection matrix
+  mutable size_t        L2key; //!< Key identifying the cached L2-matrix
+
   //! Auxilliary node number map used when establishing Dirichlet constraints
   static std::map<int,int> xNode;
 
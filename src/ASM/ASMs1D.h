@@ -50,6 +50,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates the spline curve directly from binary patch data.
+  virtual bool readBinary(const G2Patch& patch);
   //! \brief Writes the geometry of the SplineCurve object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
@@ -225,6 +227,11 @@ public:
   //! \param[in] param The parameter of the point in the knot-span domain
   //! \return Local element number within the patch that contains the point
   virtual int findElementContaining(const double* param) const;
+  //! \brief Evaluates the geometry mapping and its parametric derivatives.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of the coordinates w.r.t. the parameters
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
 
   //! \brief Creates a line element model of this patch for visualization.
   //! \param[out] grid The generated line grid
@@ -351,9 +358,10 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const;
+                                  bool continuous, bool newLHS) const;
 
   //! \brief Initializes the local element axes for a patch of beam elements.
   //! \param[in] Zaxis Vector defining a point in the local XZ-plane
@@ -435,6 +443,8 @@ public:
   virtual size_t getNoNodes(int basis = 0) const;
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const;
+  //! \brief Appends the knot values of the projection basis to an array.
+  virtual void getProjectionKnots(RealArray& knots) const;
 
   //! \brief Returns parameter values and node numbers of the domain corners.
   //! \param[out] u Parameter values of the domain corners
@@ -18,6 +18,9 @@
 #include "ASM2D.h"
 #include "Interface.h"
 #include "ThreadGroups.h"
+#include <memory>
+
+class SplineProjector;
 
 namespace utl {
   class Point;
@@ -89,6 +92,7 @@ private:
     int                dof;   //!< Local DOF to constrain along the boundary
     int                code;  //!< Inhomogeneous Dirichlet condition code
     std::vector<Ipair> nodes; //!< Nodes subjected to projection on the boundary
+    std::shared_ptr<SplineProjector> prj; //!< Cached projection operator
 
     //! \brief Default constructor.
     DirichletEdge(Go::SplineCurve* sc = nullptr, int d = 0, int c = 0)
@@ -136,6 +140,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates the spline surface directly from binary patch data.
+  virtual bool readBinary(const G2Patch& patch);
   //! \brief Writes the geometry of the SplineSurface object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
@@ -380,6 +386,11 @@ public:
   //! \param[in] param The parameters of the point in the knot-span domain
   //! \return Local element number within the patch that contains the point
   virtual int findElementContaining(const double* param) const;
+  //! \brief Evaluates the geometry mapping and its parametric derivatives.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of the coordinates w.r.t. the parameters
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
 
   //! \brief Calculates parameter values for visualization nodal points.
   //! \param[out] prm Parameter values in given direction for all points
@@ -513,9 +524,10 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const;
+                                  bool continuous, bool newLHS) const;
 
   //! \brief Connects all matching nodes on two adjacent boundary edges.
   //! \param[in] edge Local edge index of this patch, in range [1,4]
@@ -600,6 +612,11 @@ protected:
   void generateThreadGroups(size_t strip1, size_t strip2,
                             bool silence, bool ignoreGlobalLM);
 
+  //! \brief Generates element groups for multi-threading of boundary integrals.
+  //! \param[in] lIndex Local index [1,4] of the boundary edge
+  //! \param[in] silence If \e true, suppress threading group outprint
+  virtual void generateThreadGroups(char lIndex, bool silence, bool);
+
   //! \brief Generates element groups from a partition.
   virtual void generateThreadGroupsFromElms(const IntVec& elms);
 
@@ -647,6 +664,8 @@ public:
   virtual size_t getNoNodes(int basis = 0) const;
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const;
+  //! \brief Appends the knot values of the projection basis to an array.
+  virtual void getProjectionKnots(RealArray& knots) const;
 
   //! \brief Returns parameter values and node numbers of the domain corners.
   //! \param[out] u Parameter values of the domain corners
@@ -691,12 +710,28 @@ public:
   //! \param[in] coefs The coefficients for the field
   virtual Fields* getProjectedFields(const Vector& coefs, size_t = 0) const;
 
+  //! \brief Returns the 1D operators of a box-shaped patch.
+  //! \param[out] K One-dimensional stiffness matrix in each direction
+  //! \param[out] M One-dimensional mass matrix in each direction
+  //! \param[in] basis Which basis to return the matrices for (mixed methods)
+  //! \return \e false if the patch is not an affinely mapped rectangle
+  //!
+  //! \details The Laplace matrix of the patch is then
+  //! \f${\bf M}_2\otimes{\bf K}_1 + {\bf K}_2\otimes{\bf M}_1\f$,
+  //! in the nodal ordering of the basis, see FastDiagSolver.
+  virtual bool getTensorOperators(Matrices& K, Matrices& M,
+                                  int basis = 1) const;
+
 private:
   //! \brief Returns an index into the internal coefficient array for a node.
   //! \param[in] inod 0-based node index local to current patch
   int coeffInd(size_t inod) const;
 
 protected:
+  //! \brief Checks if the geometry is an affinely mapped rectangle.
+  //! \param[out] L Physical edge lengths in each parameter direction
+  bool getBoxLengths(double* L) const;
+
   Go::SplineSurface* surf; //!< Pointer to the actual spline surface object
   Go::SplineSurface* proj; //!< Pointer to spline surface for projection basis
   Go::SplineCurve* bou[4]; //!< Pointers to the four boundary curves
@@ -713,6 +748,8 @@ protected:
 
   //! Element groups for multi-threaded assembly
   ThreadGroups threadGroups;
+  //! Element groups for multi-threaded edge assembly
+  std::map<char,ThreadGroups> threadGroupsEdge;
 };
 
 #endif
@@ -157,6 +157,16 @@ public:
   //! \param[out] n2 Number of nodes in second (v) direction
   virtual bool getSize(int& n1, int& n2, int = 0) const;
 
+  //! \brief Returns the element-internal nodes of this patch.
+  //! \param[out] nodes 1-based node indices local to current patch
+  virtual void getInternalNodes(IntVec& nodes) const;
+
+  //! \brief Returns the 1D operators of a box-shaped patch.
+  //! \details Not available for Lagrange elements (the spline version
+  //! inherited from the parent class does not apply to the Lagrange nodes).
+  virtual bool getTensorOperators(Matrices&, Matrices&, int) const
+  { return false; }
+
   using ASMs2D::generateThreadGroups;
   //! \brief Generates element groups for multi-threading of interior integrals.
   virtual void generateThreadGroups(const Integrand&, bool, bool);
@@ -18,6 +18,9 @@
 #include "ASM3D.h"
 #include "Interface.h"
 #include "ThreadGroups.h"
+#include <memory>
+
+class SplineProjector;
 
 namespace utl {
   class Point;
@@ -108,6 +111,7 @@ private:
     int                dof;   //!< Local DOF to constrain along the boundary
     int                code;  //!< Inhomogeneous Dirichlet condition code
     std::vector<Ipair> nodes; //!< Nodes subjected to projection on the boundary
+    std::shared_ptr<SplineProjector> prj; //!< Cached projection operator
 
     //! \brief Default constructor.
     DirichletFace(Go::SplineSurface* ss = nullptr, int d = 0, int c = 0)
@@ -156,6 +160,8 @@ public:
 
   //! \brief Creates an instance by reading the given input stream.
   virtual bool read(std::istream&);
+  //! \brief Creates the spline volume directly from binary patch data.
+  virtual bool readBinary(const G2Patch& patch);
   //! \brief Writes the geometry of the SplineVolume object to given stream.
   virtual bool write(std::ostream&, int = 0) const;
 
@@ -451,6 +457,11 @@ public:
   //! \param[in] param The parameters of the point in the knot-span domain
   //! \return Local element number within the patch that contains the point
   virtual int findElementContaining(const double* param) const;
+  //! \brief Evaluates the geometry mapping and its parametric derivatives.
+  //! \param[in] param The parameters of the point in the knot-span domain
+  //! \param[out] X The Cartesian coordinates of the point
+  //! \param[out] dXdu Derivatives of the coordinates w.r.t. the parameters
+  virtual bool evalGeometry(const double* param, Vec3& X, Matrix& dXdu) const;
 
   //! \brief Calculates parameter values for visualization nodal points.
   //! \param[out] prm Parameter values in given direction for all points
@@ -581,9 +592,10 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const;
+                                  bool continuous, bool newLHS) const;
 
   //! \brief Connects all matching nodes on two adjacent boundary faces.
   //! \param[in] face Local face index of this patch, in range [1,6]
@@ -717,6 +729,8 @@ public:
   virtual size_t getNoNodes(int basis = 0) const;
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const;
+  //! \brief Appends the knot values of the projection basis to an array.
+  virtual void getProjectionKnots(RealArray& knots) const;
 
   //! \brief Returns parameter values and node numbers of the domain corners.
   //! \param[out] u Parameter values of the domain corners
@@ -765,6 +779,20 @@ public:
   //! \param[in] coefs The coefficients for the field
   virtual Fields* getProjectedFields(const Vector& coefs, size_t = 0) const;
 
+  //! \brief Returns the 1D operators of a box-shaped patch.
+  //! \param[out] K One-dimensional stiffness matrix in each direction
+  //! \param[out] M One-dimensional mass matrix in each direction
+  //! \param[in] basis Which basis to return the matrices for (mixed methods)
+  //! \return \e false if the patch is not an affinely mapped box
+  //!
+  //! \details The Laplace matrix of the patch is then
+  //! \f${\bf M}_3\otimes{\bf M}_2\otimes{\bf K}_1 +
+  //! {\bf M}_3\otimes{\bf K}_2\otimes{\bf M}_1 +
+  //! {\bf K}_3\otimes{\bf M}_2\otimes{\bf M}_1\f$,
+  //! in the nodal ordering of the basis, see FastDiagSolver.
+  virtual bool getTensorOperators(Matrices& K, Matrices& M,
+                                  int basis = 1) const;
+
 private:
   //! \brief Returns an index into the internal coefficient array for a node.
   //! \param[in] inod 0-based node index local to current patch
@@ -786,6 +814,10 @@ private:
   bool getFaceSize(int& n1, int& n2, int basis, int face) const;
 
 protected:
+  //! \brief Checks if the geometry is an affinely mapped rectangular box.
+  //! \param[out] L Physical edge lengths in each parameter direction
+  bool getBoxLengths(double* L) const;
+
   Go::SplineVolume* svol;  //!< Pointer to the actual spline volume object
   Go::SplineVolume* proj;  //!< Pointer to spline volume for projection basis
   bool              swapW; //!< Has the w-parameter direction been swapped?
@@ -72,6 +72,12 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
                             const RealArray*, bool) const;
 
+  //! \brief Returns the 1D operators of a box-shaped patch.
+  //! \param[out] K One-dimensional stiffness matrix in each direction
+  //! \param[out] M One-dimensional (diagonal) mass matrix in each direction
+  //! \return \e false if the patch is not an affinely mapped box
+  virtual bool getTensorOperators(Matrices& K, Matrices& M, int) const;
+
 protected:
 
   // Internal utility methods
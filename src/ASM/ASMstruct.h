@@ -81,6 +81,11 @@ public:
   //! \brief Checks if a separate projection basis is used for this patch.
   virtual bool separateProjectionBasis() const;
 
+  //! \brief Computes the element border parameters.
+  //! \param[in] iel 1-based element index
+  //! \param[out] u Parameter values of the element borders
+  virtual void getElementBorders(int iel, double* u) const = 0;
+
 protected:
   //! \brief Adds extraordinary nodes associated with a patch boundary.
   //! \param[in] dim Dimension of the boundary
@@ -101,11 +106,6 @@ protected:
   bool checkThreadGroups(const std::vector<std::set<int>>& nodes,
                          int group, bool ignoreGlobalLM);
 
-  //! \brief Computes the element border parameters.
-  //! \param[in] iel 1-based element index
-  //! \param[out] u Parameter values of the element borders
-  virtual void getElementBorders(int iel, double* u) const = 0;
-
 protected:
   Go::GeomObject* geomB; //!< Pointer to spline object of the geometry basis
   Go::GeomObject* projB; //!< Pointer to spline object of the projection basis
@@ -17,6 +17,7 @@
 #include "GlobalIntegral.h"
 #include "SystemMatrix.h"
 
+class StaticCondensation;
 
 /*!
   \brief Class for storage of general algebraic system of equations.
@@ -63,6 +64,9 @@ public:
   //! \param[in] newLHS If \e false, only right-hand-side vectors was assembled
   virtual bool finalize(bool newLHS);
 
+  //! \brief Returns \e true if the system matrices are being assembled.
+  virtual bool assemblesLHS() const { return withLHS; }
+
   //! \brief Adds a set of element matrices into the algebraic equation system.
   //! \param[in] elmObj Pointer to the element matrices to add into \a *this
   //! \param[in] elmId Global number of the element associated with \a *elmObj
@@ -81,6 +85,10 @@ public:
   //! \brief Returns a pointer to the nodal reaction forces, if any.
   const Vector* getReactions() const { return R.empty() ? 0 : &R; }
 
+  //! \brief Enables static condensation of the element-internal DOFs.
+  //! \param[in] sc The condensation data, owned by the calling object
+  void setCondensation(StaticCondensation* sc) { cond = sc; }
+
 private:
   //! \brief Struct defining a coefficient matrix and an associated RHS-vector.
   struct SysMatrixPair
@@ -100,6 +108,10 @@ private:
 
   const SAM&        sam; //!< Data for FE assembly management
   const ProcessAdm* adm; //!< Parallel process administrator
+
+  StaticCondensation* cond; //!< Element-internal DOF condensation data
+
+  bool withLHS; //!< If \e true, the system matrices are being assembled
 };
 
 #endif
@@ -0,0 +1,124 @@
+// $Id$
+//==============================================================================
+//!
+//! \file ElementLocator.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Spatial search for the element containing a given point.
+//!
+//==============================================================================
+
+#ifndef _ELEMENT_LOCATOR_H
+#define _ELEMENT_LOCATOR_H
+
+#include <vector>
+#include <cstddef>
+
+class ASMbase;
+class ASMstruct;
+class Vec3;
+
+
+/*!
+  \brief Bounding volume hierarchy over the elements of a spline model.
+
+  \details The bounding box of each element is computed from its control
+  points, which by the convex hull property of the splines enclose the element.
+  The boxes are organized in a binary tree by recursive median splitting
+  along the longest axis. A spatial point is then located by traversing the
+  tree, followed by a Newton inversion of the geometry mapping of each
+  candidate element. Only structured spline patches are indexed.
+*/
+
+class ElementLocator
+{
+public:
+  //! \brief The constructor builds the search tree.
+  //! \param[in] model The spline patches to index
+  //! \param[in] tol Tolerance for the point inversion, relative to element size
+  explicit ElementLocator(const std::vector<ASMbase*>& model,
+                          double tol = 1.0e-8);
+
+  //! \brief Returns the number of indexed elements.
+  size_t size() const { return elms.size(); }
+
+  //! \brief Finds the patch, element and parameters of a spatial point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] param The parameters of the point in the knot-span domain
+  //! \param[out] iel 1-based element index within the patch (optional)
+  //! \return 1-based local patch index, or 0 if outside the model
+  int locate(const Vec3& X, double* param, int* iel = nullptr) const;
+
+  //! \brief Finds the patches and parameters of a set of spatial points.
+  //! \param[in] X Cartesian coordinates of the points
+  //! \param[out] patch 1-based local patch index of each point, 0 if outside
+  //! \param[out] param The parameters of the points, three values per point
+  //!
+  //! \details The candidate elements of all points are first found in
+  //! parallel. The point inversions are then grouped by patch and done in
+  //! parallel over the patches, such that each spline object is evaluated
+  //! by one thread only. A point on a patch interface is assigned to the
+  //! first patch containing it.
+  void locate(const std::vector<Vec3>& X, std::vector<int>& patch,
+              std::vector<double>& param) const;
+
+private:
+  //! \brief Axis-aligned bounding box.
+  struct Box
+  {
+    double lo[3]; //!< Lower corner
+    double hi[3]; //!< Upper corner
+
+    //! \brief Default constructor initializing an empty box.
+    Box();
+    //! \brief Expands the box to enclose another box.
+    void add(const Box& box);
+    //! \brief Returns the length of the box diagonal.
+    double size() const;
+    //! \brief Returns \e true if the point \a X is inside the box.
+    bool contains(const Vec3& X) const;
+  };
+
+  //! \brief An indexed element.
+  struct Elm
+  {
+    size_t ipch; //!< Index of the patch containing the element
+    int    iel;  //!< 1-based element index within the patch
+    Box    box;  //!< Bounding box of the element control points
+  };
+
+  //! \brief A node in the bounding volume hierarchy.
+  struct Node
+  {
+    Box    box;   //!< Bounding box of all elements below this node
+    size_t child; //!< Index of the first child node, 0 for leaf nodes
+    size_t first; //!< Index of the first element below this node
+    size_t count; //!< Number of elements below this node
+  };
+
+  //! \brief Recursively builds the tree over the elements [first,last).
+  void build(size_t inode, size_t first, size_t last);
+
+  //! \brief Finds the elements with a bounding box containing a point.
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] elmIdx Indices of the candidate elements in \a elms
+  void candidates(const Vec3& X, std::vector<size_t>& elmIdx) const;
+
+  //! \brief Inverts the geometry mapping of an element.
+  //! \param[in] elm The element to invert
+  //! \param[in] X Cartesian coordinates of the point
+  //! \param[out] param The parameters of the point in the knot-span domain
+  //! \return \e true if the point is within the element, otherwise \e false
+  bool invert(const Elm& elm, const Vec3& X, double* param) const;
+
+  double epsX; //!< Relative tolerance for the point inversion
+
+  std::vector<const ASMstruct*> patches; //!< The indexed patches
+  std::vector<Elm>              elms;    //!< The indexed elements
+  std::vector<Node>             tree;    //!< The bounding volume hierarchy
+};
+
+#endif
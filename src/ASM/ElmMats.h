@@ -17,6 +17,8 @@
 #include "LocalIntegral.h"
 #include "MatVec.h"
 
+class DiagMatrix;
+
 
 /*!
   \brief Class collecting the element matrices associated with a FEM problem.
@@ -53,6 +55,13 @@ public:
 
   //! \brief Returns the element-level Newton matrix.
   virtual const Matrix& getNewtonMatrix() const;
+  //! \brief Returns the element-level Newton matrix for a diagonal system.
+  //! \details The arguments are the diagonal system matrix, which defines the
+  //! lumping scheme, and the number of DOFs per element node.
+  //! This version returns the Newton matrix as is, which then is lumped
+  //! as a whole when assembled into the diagonal system matrix.
+  virtual const Matrix& getDiagNewtonMatrix(const DiagMatrix&, size_t) const
+  { return this->getNewtonMatrix(); }
 
   //! \brief Returns the element-level right-hand-side vector
   //! associated with the Newton matrix.
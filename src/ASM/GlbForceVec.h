@@ -16,7 +16,6 @@
 
 #include "GlobalIntegral.h"
 #include "MatVec.h"
-#include <map>
 
 class LocalIntegral;
 class Vec3;
@@ -25,20 +24,40 @@ class SAM;
 
 /*!
   \brief Class for storage of a global nodal force vector with assembly methods.
+
+  \details The global node numbers are mapped to force indices through a dense
+  index vector over all nodes in the model, such that the assembly only needs
+  a direct lookup for each element node. The lookup is read-only, thus element
+  forces may be assembled concurrently as long as the elements processed by
+  different threads do not share any nodes, as ensured by the thread groups.
 */
 
 class GlbForceVec : public GlobalIntegral
 {
 public:
   //! \brief The constructor only sets its reference to the SAM object.
-  explicit GlbForceVec(const SAM& _sam) : sam(_sam) {}
+  explicit GlbForceVec(const SAM& _sam) : sam(_sam), bCode(0), bNodes(0),
+                                          bSum(0) {}
   //! \brief Empty destructor.
   virtual ~GlbForceVec() {}
 
   //! \brief Initializes the global node map and allocates the force vector.
   //! \param[in] globalNodes The global node numbers that will have force terms
   //! \param[in] nfc Number of force components
-  bool initNodeMap(const std::vector<int>& globalNodes, size_t nfc);
+  //! \param[in] code Property code of the boundary owning the nodes
+  //!
+  //! \details Duplicated node numbers, e.g., nodes on patch interfaces that
+  //! are visited once for each patch, are only stored once.
+  bool initNodeMap(const std::vector<int>& globalNodes, size_t nfc,
+                   int code = 0);
+  //! \brief Checks whether the node map is initialized for a given boundary.
+  //! \param[in] globalNodes The global node numbers of the boundary
+  //! \param[in] code Property code of the boundary
+  //!
+  //! \details The node map is reused only if both the boundary code and
+  //! the node list (its size and checksum) are unchanged since it was built,
+  //! such that a renumbering or change of the boundary is detected.
+  bool hasNodeMap(const std::vector<int>& globalNodes, int code) const;
 
   //! \brief Initializes the global nodal force vector to zero.
   virtual void initialize(bool = false);
@@ -64,13 +83,16 @@ public:
   int getForce(size_t indx, Vec3& force) const;
 
   //! \brief Returns the size in terms of number of nodes with nodal forces.
-  size_t size() const { return nodeMap.size(); }
+  size_t size() const { return nodeNum.size(); }
 
 private:
-  const SAM&           sam;     //!< Data for FE assembly management
-  Matrix               F;       //!< Global nodal forces
-  std::vector<int>     nodeNum; //!< Global node numbers with forces
-  std::map<int,size_t> nodeMap; //!< Maps from global node number to force index
+  const SAM&          sam;     //!< Data for FE assembly management
+  Matrix              F;       //!< Global nodal forces
+  std::vector<int>    nodeNum; //!< Global node numbers with forces
+  std::vector<size_t> nodeIdx; //!< 1-based force index of each global node
+  int                 bCode;   //!< Property code of current boundary
+  size_t              bNodes;  //!< Number of nodes in current boundary list
+  size_t              bSum;    //!< Checksum of current boundary node list
 };
 
 #endif
@@ -43,6 +43,8 @@ public:
 
   //! \brief Returns \e true if all elements can be assembled in parallel.
   virtual bool threadSafe() const { return false; }
+  //! \brief Returns \e true if coefficient matrices are being assembled.
+  virtual bool assemblesLHS() const { return false; }
 
   //! \brief Returns \e false if no contributions from a specified patch.
   virtual bool haveContributions(size_t, const std::vector<Property>&) const
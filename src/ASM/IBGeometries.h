@@ -52,6 +52,13 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Returns a string uniquely identifying the geometry.
+  virtual std::string signature() const;
+
+  //! \brief Returns the bounding box of the hole.
+  virtual void getBoundingBox(double& xmin, double& ymin,
+                              double& xmax, double& ymax) const;
+
 protected:
   double R;  //!< Hole radius
   double Xc; //!< X-coordinate of hole center
@@ -77,6 +84,13 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Returns a string uniquely identifying the geometry.
+  virtual std::string signature() const;
+
+  //! \brief Returns the bounding box of the hole.
+  virtual void getBoundingBox(double& xmin, double& ymin,
+                              double& xmax, double& ymax) const;
+
 private:
   double X1; //!< X-coordinate of second circle center
   double Y1; //!< Y-coordinate of second circle center
@@ -87,15 +101,19 @@ private:
 
 /*!
   \brief Class representing a plate perforated by multiple holes.
+  \details The holes may be indexed by a uniform grid of cells covering the
+  bounding box of all holes, where each cell refers to the holes whose
+  bounding box overlaps it. The inside-outside test then only needs to
+  check the holes of the cell containing the query point.
 */
 
 class PerforatedPlate2D : public Immersed::Geometry
 {
 public:
   //! \brief Default constructor.
-  PerforatedPlate2D() {}
+  PerforatedPlate2D() : nX(0), nY(0) {}
   //! \brief Constructor creating a single hole.
-  explicit PerforatedPlate2D(Hole2D* hole) : holes({hole}) { }
+  explicit PerforatedPlate2D(Hole2D* hole) : holes({hole}), nX(0), nY(0) {}
   //! \brief The destructor deletes the holes.
   virtual ~PerforatedPlate2D();
 
@@ -110,8 +128,23 @@ public:
   //! \brief Creates a finite element model of the geometry for visualization.
   virtual ElementBlock* tesselate() const;
 
+  //! \brief Builds the grid index over the holes.
+  virtual void initIndex();
+
+  //! \brief Returns a string uniquely identifying the geometry.
+  virtual std::string signature() const;
+
 private:
   std::vector<Hole2D*> holes; //!< The holes that perforate the plate
+
+  double Xmin; //!< X-coordinate of the lower-left corner of the index grid
+  double Ymin; //!< Y-coordinate of the lower-left corner of the index grid
+  double dX;   //!< Cell size of the index grid in X-direction
+  double dY;   //!< Cell size of the index grid in Y-direction
+  int    nX;   //!< Number of index grid cells in X-direction
+  int    nY;   //!< Number of index grid cells in Y-direction
+
+  std::vector< std::vector<size_t> > cells; //!< Holes overlapping each cell
 };
 
 
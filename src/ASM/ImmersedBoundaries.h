@@ -19,6 +19,7 @@
 #endif
 
 #include <vector>
+#include <string>
 
 class Vec3;
 
@@ -61,6 +62,17 @@ namespace Immersed //! Utilities for immersed boundary calculations
 
     //! \brief Creates a finite element model of the geometry for visualization.
     virtual ElementBlock* tesselate() const { return nullptr; }
+
+    //! \brief Builds the spatial search structures of the geometry, if any.
+    //! \details This method must be invoked after the geometry is complete,
+    //! and before it is queried by the inside-outside test from parallel
+    //! threads. Sub-classes without search structures need not override it.
+    virtual void initIndex() {}
+
+    //! \brief Returns a string uniquely identifying the geometry.
+    //! \details Quadrature points are cached for geometries with a non-empty
+    //! signature only.
+    virtual std::string signature() const { return ""; }
   };
 
   //! \brief Returns the coordinates and weights for the quadrature points.
@@ -81,7 +93,12 @@ namespace Immersed //! Utilities for immersed boundary calculations
   //! 0=xi, 1=eta, 2=zeta, 3=weight in 3D)
   //! \param grid Points to an \a ElementBlock plotting the added grid lines
   //!
-  //! \details The element corner points are ordered according to a standard
+  //! \details The elements are processed in parallel, unless \a grid is
+  //! given. If the quadrature cache is enabled, the points of intersected
+  //! elements are reused from the cache whenever the same element (in terms
+  //! of corner coordinates) has been processed before for the same geometry.
+  //!
+  //! The element corner points are ordered according to a standard
   //! tensor-product definition of the element, i.e., the index runs fastest
   //! in the first parameter direction, then in the second direction, and
   //! finally (in 3D) the third direction.
@@ -119,8 +136,25 @@ namespace Immersed //! Utilities for immersed boundary calculations
     SUBDIV_INTERFACES = 2
   };
 
+  //! \brief Reads cached quadrature points from the named file.
+  bool readCache(const std::string& fileName);
+  //! \brief Writes the cached quadrature points to the named file.
+  bool writeCache(const std::string& fileName);
+  //! \brief Writes the cache to the persistent cache file, if modified.
+  //! \details Invoke once after the quadrature points of all patches have
+  //! been calculated, rather than for each patch.
+  bool saveCache();
+  //! \brief Clears the quadrature point cache.
+  //! \details The persistent cache file, if any, is read again on next use.
+  void clearCache();
+  //! \brief Returns the number of elements in the quadrature point cache.
+  size_t cacheSize();
+
   extern int stabilization; //!< Stabilization option
 
+  extern bool useCache; //!< Flags whether quadrature points should be cached
+  extern std::string cacheFile; //!< File name of the persistent cache
+
   extern bool plotCells; //!< Flags whether subcells should be plotted or not
 }
 
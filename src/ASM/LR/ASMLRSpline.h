@@ -42,6 +42,24 @@ namespace LR //! Utilities for LR-splines.
   void contractControlPoints(LRSpline* basis, Vector& v,
                              int nf, int ofs = 0);
 
+  //! \brief Expands the basis coefficients with several vectors at once.
+  //! \param basis The spline object to extend
+  //! \param[in] v The vectors to append to the basis coefficients
+  //! \param[in] nf Number of fields in the non-scalar vectors
+  //! \param[out] nfs Number of fields appended for each vector
+  //!
+  //! \details Empty vectors are skipped. The basis is rebuilt only once,
+  //! regardless of the number of vectors.
+  bool extendControlPoints(LRSpline* basis, const Vectors& v,
+                           int nf, IntVec& nfs);
+
+  //! \brief Contracts the basis coefficients into several vectors at once.
+  //! \param basis The spline object to contract
+  //! \param[out] v Vectors containing the extracted basis coefficients
+  //! \param[in] nfs Number of fields for each vector
+  void contractControlPoints(LRSpline* basis, Vectors& v,
+                             const IntVec& nfs);
+
   //! \brief Extracts parameter values of the Gauss points in one direction.
   //! \param[in] spline The LR-spline object to get parameter values for
   //! \param[out] uGP Parameter values in given direction for all points
@@ -56,9 +74,13 @@ namespace LR //! Utilities for LR-splines.
   //! \param[out] threadGroups The generated thread groups
   //! \param[in] lr The LR-spline to generate thread groups for
   //! \param[in] addConstraints If given, additional constraint bases
+  //! \param colors If given, the element colours of the generated groups.
+  //! If it on input has one entry per element of \a lr, only the elements
+  //! with a zero entry are coloured, the others keep their colour.
   void generateThreadGroups(ThreadGroups& threadGroups,
                             const LRSpline* lr,
-                            const std::vector<LRSpline*>& addConstraints = {});
+                            const std::vector<LRSpline*>& addConstraints = {},
+                            IntVec* colors = nullptr);
 }
 
 
@@ -193,7 +215,18 @@ protected:
   //! \param groups The generated thread groups
   static void analyzeThreadGroups(const IntMat& groups);
 
+  //! \brief Checks the linear independence of the refined region only.
+  //! \param[in] changed Flags the elements affected by the refinement
+  //! \return \e false if the test is inconclusive
+  bool isLinearIndepLocal(const std::vector<bool>& changed) const;
+
   LR::LRSpline* geo; //!< Pointer to the actual spline geometry object
+
+  IntVec elmColors; //!< Element colours of the multi-threading groups
+  //! Flags the elements that are changed by refinement since the
+  //! FE topology was generated (empty if unknown)
+  std::vector<bool> elmChanged;
+  size_t linIndepElms; //!< Number of elements when last found independent
 };
 
 #endif
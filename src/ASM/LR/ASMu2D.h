@@ -19,9 +19,11 @@
 #include "Interface.h"
 #include "LRSpline/LRSpline.h"
 #include "ThreadGroups.h"
+#include "Vec3.h"
 #include <memory>
 
 class FiniteElement;
+class SparseMatrix;
 
 namespace utl {
   class Point;
@@ -165,6 +167,8 @@ public:
 
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const;
+  //! \brief Appends the knot values of the projection basis to an array.
+  virtual void getProjectionKnots(RealArray& knots) const;
 
   //! \brief Refines along the diagonal of the LR-spline patch.
   //! \details Progressively refine until the LR-spline object contains at least
@@ -436,6 +440,10 @@ protected:
     int                 dof;       //!< Local DOF to constrain along the boundary
     int                 code;      //!< Inhomogeneous Dirichlet condition code
     int                 corners[2];//!< Index of the two end-points of this line
+    std::shared_ptr<SparseMatrix> mass; //!< Cached edge mass matrix
+    std::vector<Vec3>   gX;   //!< Cartesian coordinates of quadrature points
+    IntVec              gElm; //!< Edge element index of each quadrature point
+    Real2DMat           gNw;  //!< Basis function values times detJxW
 
     //! \brief The constructor detects the edge end points.
     DirichletEdge(LR::LRSplineSurface* sf, int dir,
@@ -478,6 +486,10 @@ public:
   virtual bool evalSolution(Matrix& sField, const IntegrandBase& integrand,
                             const RealArray* gpar, bool = false) const;
 
+  //! \brief Assembles and factorizes the edge mass matrix for Dirichlet L2-fit.
+  //! \param edge low-level edge information, the quadrature data is cached
+  bool edgeL2setup(DirichletEdge& edge) const;
+
   //! \brief Projects inhomogenuous dirichlet conditions by continuous L2-fit.
   //! \param[in] edge low-level edge information needed to do integration
   //! \param[in] values inhomogenuous function which is to be fitted
@@ -521,9 +533,10 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const;
+                                  bool continuous, bool newLHS) const;
 
   //! \brief Connects all matching nodes on two adjacent boundary edges.
   //! \param[in] edge Local edge index of this patch, in range [1,4]
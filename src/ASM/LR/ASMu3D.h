@@ -144,6 +144,8 @@ public:
 
   //! \brief Returns the number of projection nodes for this patch.
   virtual size_t getNoProjectionNodes() const;
+  //! \brief Appends the knot values of the projection basis to an array.
+  virtual void getProjectionKnots(RealArray& knots) const;
 
   //! \brief Refines the parametrization by inserting tensor knots uniformly.
   //! \param[in] dir Parameter direction to refine
@@ -505,9 +507,10 @@ protected:
   //! \param[out] B Right-hand-side vectors
   //! \param[in] integrand Object with problem-specific data and methods
   //! \param[in] continuous If \e false, a discrete L2-projection is used
+  //! \param[in] newLHS If \e false, only the right-hand-side is assembled
   virtual bool assembleL2matrices(SparseMatrix& A, StdVector& B,
                                   const IntegrandBase& integrand,
-                                  bool continuous) const;
+                                  bool continuous, bool newLHS) const;
 
   //! \brief Connects all matching nodes on two adjacent boundary faces.
   //! \param[in] face Local face index of this patch, in range [1,6]
@@ -45,6 +45,15 @@ public:
 
   //! \brief Returns the element-level Newton matrix.
   virtual const Matrix& getNewtonMatrix() const;
+  //! \brief Returns the element-level Newton matrix for a diagonal system.
+  //! \param[in] D The diagonal system matrix, defining the lumping scheme
+  //! \param[in] ncmp Number of DOFs per element node
+  //! \details For explicit time integration (&beta; = 0), only the mass
+  //! matrix is lumped, whereas the diagonal of the stiffness and damping
+  //! matrices are added as is. Otherwise, the stiffness-proportional damping
+  //! would vanish in a row-sum lumping of the entire Newton matrix.
+  virtual const Matrix& getDiagNewtonMatrix(const DiagMatrix& D,
+                                            size_t ncmp) const;
   //! \brief Returns the element-level right-hand-side vector.
   virtual const Vector& getRHSVector() const;
 
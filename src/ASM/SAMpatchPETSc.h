@@ -32,9 +32,17 @@ public:
   //! \param[in] g2ln Global-to-local node numbers for this processor
   //! \param[in] padm Parallel process administrator
   SAMpatchPETSc(const std::map<int,int>& g2ln, const ProcessAdm& padm);
-  //! \brief The destructor destroys the index set arrays.
+  //! \brief The destructor destroys the index sets and scatter contexts.
   virtual ~SAMpatchPETSc();
 
+  //! \brief Creates the index sets, scatter contexts and work vectors.
+  //! \details This method must be invoked after the domain decomposition
+  //! has been established. The created objects are then used by all subsequent
+  //! solution expansions, norm and dot-product evaluations, until the
+  //! equation system is destroyed. Only the DOF type \a 'D' is initialized
+  //! here, the other DOF types are initialized on the first use.
+  bool initScatters();
+
   //! \brief Computes the dot-product of two vectors.
   //! \param[in] x First vector in dot-product
   //! \param[in] y Second vector in dot-product
@@ -78,6 +86,22 @@ public:
   virtual bool expandSolution(const SystemVector& solVec,
                               Vector& dofVec, Real scaleSD) const;
 
+  //! \brief Starts the gathering of the local part of a solution vector.
+  //! \param[in] solVec Solution vector, length = NEQ
+  //! \return \e false if \a solVec is not a PETSc vector, otherwise \e true
+  //!
+  //! \details The communication is completed by expandSolutionEnd(),
+  //! which must be invoked with the same vector before the next call to
+  //! this method. Local work not involving \a solVec can be done in between.
+  bool expandSolutionBegin(const SystemVector& solVec) const;
+  //! \brief Completes the expansion started by expandSolutionBegin().
+  //! \param[in] solVec Solution vector, length = NEQ
+  //! \param[out] dofVec Degrees of freedom vector, length = NDOF
+  //! \param[in] scaleSD Scaling factor for specified (slave) DOFs
+  //! \return \e false if the length of \a solVec is invalid, otherwise \e true
+  bool expandSolutionEnd(const SystemVector& solVec,
+                         Vector& dofVec, Real scaleSD) const;
+
 private:
   // Parameters for parallel computing
   int    nProc;      //!< Number of processes
@@ -87,20 +111,28 @@ private:
   const ProcessAdm& adm; //!< Parallel process administrator
 
 #ifdef HAVE_MPI
-  mutable IS glob2LocEq = nullptr; //!< Index set for global-to-local equations
-
   //! \brief Struct holding dof vector info
   struct DofIS {
     IS local;        //!< Local index set for dof type
     IS global;       //!< Global index set for dof type
     int nDofs;       //!< Number of DOFs on this process
-    VecScatter ctx;  //!< Scatterer
-    bool scatterCreated = false; //!< True if the scatterer is created
+    VecScatter ctx;  //!< Scatterer from local to global DOF vectors
+    Vec lvec;        //!< Local DOF vector, wrapping the array of a Vector
+    Vec gvec[2];     //!< Global DOF vectors
   };
   mutable std::map<char,DofIS> dofIS; //!< Map of dof type scatter info
 
   //! \brief Returns a parallel index set for a given dofType.
   DofIS& getIS(char dofType) const;
+  //! \brief Scatters a local DOF vector into a global DOF vector.
+  //! \param dis Scatter info of the DOF type to consider
+  //! \param[in] x The local DOF vector
+  //! \param[in] i Index of the global DOF vector to scatter into
+  bool scatterDofs(DofIS& dis, const Vector& x, int i) const;
+
+  IS         glob2LocEq = nullptr; //!< Index set for global-to-local equations
+  VecScatter solCtx = nullptr; //!< Scatterer from global to local equations
+  Vec        solLoc = nullptr; //!< Local equation-ordered solution vector
 #endif
 };
 
@@ -0,0 +1,89 @@
+// $Id$
+//==============================================================================
+//!
+//! \file StaticCondensation.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Static condensation of element-internal degrees of freedom.
+//!
+//==============================================================================
+
+#ifndef _STATIC_CONDENSATION_H
+#define _STATIC_CONDENSATION_H
+
+#include "DenseMatrix.h"
+
+class SAM;
+
+
+/*!
+  \brief Class for static condensation of element-internal DOFs.
+
+  \details The element-internal nodes are those that are connected to one
+  element only, and which are not subjected to any boundary conditions.
+  They are fixed in the global equation system, such that they get no
+  equation numbers, and their contributions are instead eliminated from
+  the element matrices by the Schur complement
+
+  \f[ \tilde{\bf K}_{ee} =
+  {\bf K}_{ee} - {\bf K}_{ei}{\bf K}_{ii}^{-1}{\bf K}_{ie} \quad , \quad
+  \tilde{\bf f}_e = {\bf f}_e - {\bf K}_{ei}{\bf K}_{ii}^{-1}{\bf f}_i \f]
+
+  before the element matrices are added into the global system. The factorized
+  \f${\bf K}_{ii}\f$ and the coupling matrices are kept for each element,
+  such that the internal DOFs can be recovered from the global solution by
+  \f${\bf u}_i = {\bf K}_{ii}^{-1}({\bf f}_i - {\bf K}_{ie}{\bf u}_e)\f$.
+
+  The condense() methods may be invoked concurrently for different elements.
+*/
+
+class StaticCondensation
+{
+public:
+  //! \brief The constructor establishes the element DOF partitioning.
+  //! \param[in] sam Data for FE assembly management
+  //! \param[in] internalNodes Global numbers of the element-internal nodes
+  StaticCondensation(const SAM& sam, const std::vector<int>& internalNodes);
+
+  //! \brief Returns the number of condensed DOFs.
+  size_t getNoCondensedDOFs() const { return nCondensed; }
+
+  //! \brief Condenses the internal DOFs of an element matrix and vector.
+  //! \param eK The element matrix, the internal rows and columns are zeroed
+  //! \param eS The element vector, the internal entries are zeroed
+  //! \param[in] iel 1-based element index
+  bool condense(Matrix& eK, Vector& eS, int iel);
+  //! \brief Condenses the internal DOFs of an element vector only.
+  //! \param eS The element vector, the internal entries are zeroed
+  //! \param[in] iel 1-based element index
+  //!
+  //! \details This uses the factorization of the internal block from the
+  //! last invocation of the other condense() method for this element.
+  bool condense(Vector& eS, int iel);
+
+  //! \brief Recovers the internal DOFs of a global solution vector.
+  //! \param sol Solution vector in DOF-order, with the external DOFs solved
+  bool recover(Vector& sol) const;
+
+private:
+  //! \brief Condensation data for an element.
+  struct ElmData
+  {
+    std::vector<int> dofs; //!< Global DOF numbers of the element DOFs
+    std::vector<int> ext;  //!< 0-based indices of the external element DOFs
+    std::vector<int> in;   //!< 0-based indices of the internal element DOFs
+
+    DenseMatrix Kii; //!< The factorized internal block of the element matrix
+    Matrix      Kei; //!< The external-internal coupling block
+    Matrix      C;   //!< The internal block inverse times the coupling block
+    Vector      d;   //!< The internal block inverse times the internal forces
+  };
+
+  std::vector<ElmData> elms; //!< Condensation data for all elements
+  size_t         nCondensed; //!< Total number of condensed DOFs
+};
+
+#endif
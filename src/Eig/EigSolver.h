@@ -7,7 +7,7 @@
 //!
 //! \author Knut Morten Okstad / SINTEF
 //!
-//! \brief Interface to LAPack, ARPack and SLEPc eigenvalue solvers.
+//! \brief Interface to LAPack, ARPack, LOBPCG and SLEPc eigenvalue solvers.
 //!
 //==============================================================================
 
@@ -32,13 +32,20 @@ namespace eig //! Top-level functions for invoking eigenproblem solvers.
 	     Vector& eigVal, Matrix& eigVec, int nev);
 
   //! \brief Solves the eigenvalue problem (A-lambda*B)*x = 0 using ARPACK.
+  //! \details Modes 7 and 8 use the block LOBPCG solver instead, with and
+  //! without preconditioning, respectively. The preconditioner is the
+  //! iterative solver (with AMG or ILU preconditioning) of the stiffness
+  //! matrix for ISTL and PETSc matrices, otherwise its inverse diagonal
+  //! (Jacobi). The stiffness matrix is shifted by the mass matrix if \a shift
+  //! is nonzero. The parameter \a ncv is the block size.
   //! \param A The system stiffness matrix
   //! \param B The system mass matrix
   //! \param[out] eigVal Computed eigenvalues
   //! \param[out] eigVec Computed eigenvectors
   //! \param[in] nev Number of eigenvalues/vectors (see ARPack documentation)
   //! \param[in] ncv Number of Arnoldi vectors (see ARPack documentation)
-  //! \param[in] mode Eigensolver method (1,...5, see ARPack documentation)
+  //! \param[in] mode Eigensolver method (1,...6, see ARPack documentation,
+  //! 7 = preconditioned LOBPCG, 8 = unpreconditioned LOBPCG)
   //! \param[in] shift Eigenvalue shift
   bool solve(SystemMatrix* A, SystemMatrix* B,
 	     Vector& eigVal, Matrix& eigVec, int nev, int ncv,
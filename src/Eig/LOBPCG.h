@@ -0,0 +1,50 @@
+// $Id$
+//==============================================================================
+//!
+//! \file LOBPCG.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Block LOBPCG solver for symmetric-definite eigenproblems.
+//!
+//==============================================================================
+
+#ifndef _LOBPCG_H
+#define _LOBPCG_H
+
+#include "MatVec.h"
+
+class SystemMatrix;
+
+
+namespace eig
+{
+  //! \brief Solves the eigenproblem (A-lambda*B)*x = 0 using block LOBPCG.
+  //! \details The Locally Optimal Block Preconditioned Conjugate Gradient
+  //! method computes the \a nev smallest eigenvalues of the symmetric pencil
+  //! (\b A,\b B), where \b B is positive definite. All operations on the
+  //! search space are expressed as multi-vector products, such that the
+  //! sparse matrices are traversed once per iteration for the whole block
+  //! (or once per thread, for the column-oriented SuperLU format),
+  //! and the dense algebra is performed through BLAS-3 kernels.
+  //! \param[in] A The system stiffness matrix
+  //! \param[in] B The system mass matrix (identity if null)
+  //! \param T Optional preconditioner, its solve() method is applied to the
+  //! residual vectors. Typically a diagonal (Jacobi) matrix, or an
+  //! iterative solver configured with an AMG or ILU preconditioner.
+  //! \param[out] eigVal Computed eigenvalues
+  //! \param eigVec Computed eigenvectors.
+  //! If dimensioned on input, its columns are used as initial guess.
+  //! \param[in] nev Number of eigenvalues/vectors to compute
+  //! \param[in] nbl Block size (at least \a nev, and at most one third of
+  //! the number of equations)
+  //! \param[in] tol Relative residual tolerance
+  //! \param[in] maxit Maximum number of iterations
+  bool lobpcg(const SystemMatrix& A, const SystemMatrix* B, SystemMatrix* T,
+              Vector& eigVal, Matrix& eigVec, int nev, int nbl,
+              double tol = 1.0e-8, int maxit = 500);
+}
+
+#endif
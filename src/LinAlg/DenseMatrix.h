@@ -47,6 +47,13 @@ public:
   //! \details Will preserve existing matrix content within the new dimension.
   bool redim(size_t r, size_t c);
 
+  //! \brief Toggles factorization of the matrix in single precision.
+  //! \details Switching it off releases the single-precision factorization.
+  //! Switching it on fails if the matrix already is factorized in place.
+  virtual bool setSinglePrecision(bool s);
+  //! \brief Returns \e true if the matrix is factorized in single precision.
+  virtual bool isSinglePrecision() const { return single; }
+
   //! \brief Marks the matrix as symmetric.
   //! \details If marked as symmetric, Cholesky factorization will be employed.
   void setSymmetric(bool s = true) { symm = s && myMat.rows() == myMat.cols(); }
@@ -122,15 +129,21 @@ public:
 
   //! \brief Performs the matrix-vector multiplication \b C = \a *this * \b B.
   virtual bool multiply(const SystemVector& B, SystemVector& C) const;
+  //! \brief Performs the multi-vector multiplication \b C = \a *this * \b B.
+  virtual bool multiply(const Matrix& B, Matrix& C) const;
+
+  //! \brief Extracts the diagonal elements of the matrix.
+  virtual bool getDiagonal(Vector& diag) const;
 
   using SystemMatrix::solve;
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool, Real* rc = nullptr);
-  //! \brief Solves the linear system of equations for a given right-hand-side.
+  //! \brief Solves the linear system of equations for several right-hand-sides.
   //! \param B Right-hand-side matrix on input, solution matrix on output
-  bool solve(Matrix& B);
+  //! \details All columns are solved for in one LAPack call (BLAS-3).
+  virtual bool solve(Matrix& B, bool = true);
 
   //! \brief Solves a standard symmetric-definite eigenproblem.
   //! \details The eigenproblem is assumed to be on the form
@@ -192,6 +205,14 @@ protected:
   //! using the LAPack library subroutines. The two public \a solve methods just
   //! forward to this method.
   bool solve(Real* B, size_t nrhs, Real* rcond = nullptr);
+  //! \brief Solves the linear system of equations in single precision.
+  //! \param B Right-hand-side vectors on input, solution vectors on output
+  //! \param[in] nrhs Number of right-hand-side vectors
+  //! \param[out] rcond Reciprocal condition number of the LHS-matrix
+  //!
+  //! \details A single-precision copy of the matrix is factorized in place,
+  //! whereas the double-precision matrix is left untouched.
+  bool solveSingle(Real* B, size_t nrhs, Real* rcond);
 
   //! \brief Writes the system matrix to the given output stream.
   virtual std::ostream& write(std::ostream& os) const { return os << myMat; }
@@ -200,6 +221,9 @@ private:
   Matrix myMat; //!< The actual dense matrix
   int*   ipiv;  //!< Pivot indices used in \a solve
   bool   symm;  //!< Flags whether the matrix is symmetric or not
+  bool   single; //!< Flags whether to factorize in single precision
+
+  std::vector<float> lowMat; //!< Single-precision factors of \a myMat
 };
 
 //! \brief Multiply a matrix with a scalar.
@@ -19,15 +19,26 @@
 
 /*!
   \brief Class for representing a diagonal system matrix.
+  \details Element matrices with more than one DOF are lumped into diagonal
+  matrices during the assembly. This is typically used for lumped mass
+  matrices in explicit time integration, or for one-dof elements (modes).
 */
 
 class DiagMatrix : public SystemMatrix
 {
 public:
+  //! \brief Enum defining the available lumping schemes.
+  enum Lumping
+  {
+    ROWSUM, //!< Row-sum lumping
+    HRZ,    //!< Diagonal scaling (Hinton-Rock-Zienkiewicz)
+    ABSSUM  //!< Sum of absolute values (Gershgorin bound)
+  };
+
   //! \brief Default constructor.
-  DiagMatrix(size_t m = 0) : myMat(m) {}
+  DiagMatrix(size_t m = 0) : myMat(m), lumping(ROWSUM) {}
   //! \brief Copy constructor.
-  DiagMatrix(const DiagMatrix& A) : myMat(A.myMat) {}
+  DiagMatrix(const DiagMatrix& A) : myMat(A.myMat), lumping(A.lumping) {}
   //! \brief Special constructor taking data from a one-dimensional array.
   DiagMatrix(const RealArray& data, size_t nrows = 0);
   //! \brief Empty destructor.
@@ -46,6 +57,28 @@ public:
   //! \brief Returns the dimension of the system matrix.
   virtual size_t dim(int) const { return myMat.size(); }
 
+  //! \brief Defines how the element matrices are lumped in the assembly.
+  void setLumping(Lumping method) { lumping = method; }
+  //! \brief Returns the lumping scheme of the element matrices.
+  Lumping getLumping() const { return lumping; }
+
+  //! \brief Lumps an element matrix into a diagonal matrix.
+  //! \param[in] eM The element matrix
+  //! \param[out] d The diagonal of the lumped matrix
+  //! \param[in] method The lumping scheme to use
+  //! \param[in] ncmp Number of DOFs per node (components)
+  //! \details The element DOFs are assumed ordered node by node. With the HRZ
+  //! scheme, the diagonal terms of each component are scaled separately.
+  static void lump(const Matrix& eM, RealArray& d, Lumping method,
+                   size_t ncmp = 1);
+
+  //! \brief Returns the number of DOFs per node of an element.
+  //! \param[in] sam Auxiliary data describing the FE model topology, etc.
+  //! \param[in] e Identifier for the element
+  //! \param[in] nedof Number of element DOFs
+  //! \return 1 if the element nodes have different number of DOFs
+  static size_t getNodalDofs(const SAM& sam, int e, size_t nedof);
+
   //! \brief Access to the matrix itself.
   Vector& getMat() { return myMat; }
   //! \brief Index-1 based element access.
@@ -97,6 +130,9 @@ public:
   //! \brief Performs the matrix-vector multiplication \b C = \a *this * \b B.
   virtual bool multiply(const SystemVector& B, SystemVector& C) const;
 
+  //! \brief Extracts the diagonal elements of the matrix.
+  virtual bool getDiagonal(Vector& diag) const { diag = myMat; return true; }
+
   using SystemMatrix::solve;
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
@@ -110,7 +146,8 @@ protected:
   virtual std::ostream& write(std::ostream& os) const { return os << myMat; }
 
 private:
-  Vector myMat; //!< The actual diagonal matrix
+  Vector  myMat;   //!< The actual diagonal matrix
+  Lumping lumping; //!< Lumping scheme for element matrices
 };
 
 #endif
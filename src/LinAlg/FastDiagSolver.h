@@ -0,0 +1,94 @@
+// $Id$
+//==============================================================================
+//!
+//! \file FastDiagSolver.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Fast diagonalisation solver for tensor-product operators.
+//!
+//==============================================================================
+
+#ifndef _FAST_DIAG_SOLVER_H
+#define _FAST_DIAG_SOLVER_H
+
+#include "MatVec.h"
+
+
+/*!
+  \brief Class for solving equation systems with tensor-product structure.
+
+  \details The coefficient matrix is assumed to be on the form (in 2D)
+  \f[ {\bf A} = {\bf M}_2\otimes{\bf K}_1 + {\bf K}_2\otimes{\bf M}_1
+      + \sigma\,{\bf M}_2\otimes{\bf M}_1 \f]
+  where \f${\bf K}_d\f$ and \f${\bf M}_d\f$ are the one-dimensional stiffness
+  and mass matrices in parameter direction \a d, and \f$\sigma\f$ is an
+  optional shift (e.g., a reaction or inverse time step term). This is the
+  structure of the Laplace operator on box-shaped single-patch models with
+  a Cartesian grid, for both spline and spectral discretizations.
+
+  The one-dimensional generalized eigenproblems
+  \f${\bf K}_d{\bf S}_d = {\bf M}_d{\bf S}_d\Lambda_d\f$ are solved in init(),
+  and the inverse is then applied as
+  \f${\bf A}^{-1} = ({\bf S}_2\otimes{\bf S}_1)
+  (\Lambda_2\otimes{\bf I} + {\bf I}\otimes\Lambda_1 + \sigma{\bf I})^{-1}
+  ({\bf S}_2\otimes{\bf S}_1)^T\f$,
+  using one-dimensional matrix products only (Lynch, Rice and Thomas 1964).
+  For \a N unknowns in \a d dimensions the cost is \f$O(N^{1+1/d})\f$.
+  The same method may be used as a preconditioner for problems with
+  variable coefficients or non-affine geometries.
+
+  The unknowns are ordered with the first parameter direction running
+  fastest, which is the nodal ordering of the structured patches.
+*/
+
+class FastDiagSolver
+{
+public:
+  //! \brief Default constructor.
+  FastDiagSolver() : nTot(0) {}
+
+  //! \brief Computes the one-dimensional eigen-decompositions.
+  //! \param[in] K One-dimensional stiffness matrices in each direction
+  //! \param[in] M One-dimensional mass matrices in each direction
+  //! \param[in] fixed Homogeneous Dirichlet conditions in each direction,
+  //! 1 = at the start, 2 = at the end, 3 = at both ends
+  //!
+  //! \details The fixed end points are removed from the one-dimensional
+  //! operators. The unknowns on the corresponding patch boundaries are
+  //! therefore not present in the vectors passed to solve(), see dim().
+  bool init(const Matrices& K, const Matrices& M,
+            const std::vector<int>& fixed = {});
+
+  //! \brief Returns the total number of unknowns.
+  size_t dim() const { return nTot; }
+  //! \brief Returns the number of unknowns in direction \a d.
+  size_t dim(size_t d) const { return d < S.size() ? S[d].rows() : 0; }
+
+  //! \brief Solves the equation system for a given right-hand-side.
+  //! \param b Right-hand-side vector on input, solution vector on output
+  //! \param[in] shift Coefficient of the mass term
+  //!
+  //! \details The vector contains the free unknowns only, with the first
+  //! direction running fastest. That is, if \a fixed was given in init(),
+  //! the nodes on the fixed patch boundaries are excluded.
+  //! Zero eigenvalue sums (pure Neumann problems) are skipped,
+  //! i.e., the solution is then orthogonal to the constant mode.
+  bool solve(Vector& b, Real shift = Real(0)) const;
+
+private:
+  //! \brief Multiplies the vector by a matrix in one parameter direction.
+  //! \param[in] A The one-dimensional matrix to multiply with
+  //! \param[in] transA If \e true, multiply with the transpose of \a A
+  //! \param[in] stride Distance between consecutive entries in this direction
+  //! \param x The vector to multiply
+  void apply(const Matrix& A, bool transA, size_t stride, Vector& x) const;
+
+  Matrices                S;      //!< One-dimensional eigenvectors
+  std::vector<RealArray>  lambda; //!< One-dimensional eigenvalues
+  size_t                  nTot;   //!< Total number of unknowns
+};
+
+#endif
@@ -106,22 +106,104 @@ public:
   virtual LinAlg::MatrixType getType() const { return LinAlg::ISTL; }
 
   //! \brief Returns the dimension of the system matrix.
-  virtual size_t dim(int = 1) const { return 0; }
+  virtual size_t dim(int idim = 1) const
+  {
+    return idim > 3 ? iA.nonzeroes() : SparseMatrix::dim(idim);
+  }
 
   //! \brief Creates a copy of the system matrix and returns a pointer to it.
   virtual SystemMatrix* copy() const { return new ISTLMatrix(*this); }
 
+  //! \brief The sparsity pattern of the ISTL matrix is always locked.
+  virtual bool lockPattern(bool) { return true; }
+
+  //! \brief Dumps the system matrix on a specified format.
+  virtual void dump(std::ostream& os, char format, const char* label);
+
   //! \brief Initializes the element assembly process.
   //! \details Must be called once before the element assembly loop.
-  //! The PETSc data structures are initialized and the all symbolic operations
-  //! that are needed before the actual assembly can start are performed.
+  //! The sparsity pattern of the ISTL matrix is established from the DOF
+  //! couplings of the model, whereas the storage arrays of the parent class
+  //! are not allocated. The element matrices are instead added directly into
+  //! the ISTL matrix, such that no intermediate copy of the values is needed.
   //! \param[in] sam Auxiliary data describing the FE model topology, etc.
-  //! \param[in] delayLocking If \e true, do not lock the sparsity pattern yet
-  virtual void initAssembly(const SAM& sam, bool delayLocking);
+  virtual void initAssembly(const SAM& sam, bool);
 
   //! \brief Initializes the matrix to zero assuming it is properly dimensioned.
   virtual void init();
 
+  //! \brief Adds an element matrix into the associated system matrix.
+  //! \param[in] eM  The element matrix
+  //! \param[in] sam Auxiliary data describing the FE model topology,
+  //!                nodal DOF status and constraint equations
+  //! \param[in] e   Identifier for the element that \a eM belongs to
+  //! \return \e true on successful assembly, otherwise \e false
+  virtual bool assemble(const Matrix& eM, const SAM& sam, int e);
+  //! \brief Adds an element matrix into the associated system matrix.
+  //! \details When multi-point constraints are present, contributions from
+  //! these are also added into the system right-hand-side vector.
+  //! \param[in] eM  The element matrix
+  //! \param[in] sam Auxiliary data describing the FE model topology,
+  //!                nodal DOF status and constraint equations
+  //! \param     B   The system right-hand-side vector
+  //! \param[in] e   Identifier for the element that \a eM belongs to
+  //! \return \e true on successful assembly, otherwise \e false
+  virtual bool assemble(const Matrix& eM, const SAM& sam,
+                        SystemVector& B, int e);
+  //! \brief Adds an element matrix into the associated system matrix.
+  //! \details When multi-point constraints are present, contributions from
+  //! these are also added into the system right-hand-side vector.
+  //! \param[in] eM   The element matrix
+  //! \param[in] sam  Auxiliary data describing the FE model topology,
+  //!                 nodal DOF status and constraint equations
+  //! \param     B    The system right-hand-side vector
+  //! \param[in] meen Matrix of element equation numbers
+  //! \return \e true on successful assembly, otherwise \e false
+  virtual bool assemble(const Matrix& eM, const SAM& sam,
+                        SystemVector& B, const IntVec& meen);
+
+  using SparseMatrix::assembleCol;
+  //! \brief Adds a nodal vector into columns of a non-symmetric sparse matrix.
+  //! \param[in] V   The nodal vector
+  //! \param[in] sam Auxiliary data describing the FE model topology,
+  //!                nodal DOF status and constraint equations
+  //! \param[in] n   Identifier for the node that \a V belongs to
+  //! \param[in] col Index of first column which should receive contributions
+  //! \return \e false if an element is outside the sparsity pattern
+  virtual bool assembleCol(const RealArray& V, const SAM& sam,
+                           int n, size_t col);
+
+  //! \brief Augments a similar matrix symmetrically to the current matrix.
+  //! \param[in] B  The matrix to be augmented
+  //! \param[in] r0 Row offset for the augmented matrix
+  //! \param[in] c0 Column offset for the augmented matrix
+  //! \return \e false if an element is outside the sparsity pattern
+  virtual bool augment(const SystemMatrix& B, size_t r0, size_t c0);
+
+  //! \brief Truncates all small matrix elements to zero.
+  //! \param[in] threshold Zero tolerance relative to largest diagonal element
+  //! \details The sparsity pattern is not changed.
+  virtual bool truncate(Real threshold);
+
+  //! \brief Multiplication with a scalar.
+  virtual void mult(Real alpha);
+
+  //! \brief Adds a matrix with similar sparsity pattern to the current matrix.
+  //! \param[in] B     The matrix to be added
+  //! \param[in] alpha Scale factor for matrix \b B
+  virtual bool add(const SystemMatrix& B, Real alpha = Real(1));
+
+  //! \brief Adds the diagonal matrix &sigma;\b I to the current matrix.
+  virtual bool add(Real sigma);
+
+  //! \brief Performs the matrix-vector multiplication \b C = \a *this * \b B.
+  virtual bool multiply(const SystemVector& B, SystemVector& C) const;
+  //! \brief Performs the multi-vector multiplication \b C = \a *this * \b B.
+  virtual bool multiply(const Matrix& B, Matrix& C) const;
+
+  //! \brief Extracts the diagonal elements of the matrix.
+  virtual bool getDiagonal(Vector& diag) const;
+
   //! \brief Begins communication step needed in parallel matrix assembly.
   //! \details Must be called together with endAssembly after matrix assembly
   //! is completed on each processor and before the linear system is solved.
@@ -142,9 +224,29 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   virtual bool solve(const SystemVector& B, SystemVector& x, bool newLHS);
 
+  //! \brief Solves the linear system of equations for several right-hand-sides.
+  //! \param B Right-hand-side matrix on input, solution matrix on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //! \details The columns of \b B are solved for one by one.
+  virtual bool solve(Matrix& B, bool newLHS)
+  {
+    return this->SystemMatrix::solve(B,newLHS);
+  }
+
+  //! \brief Overrides the relative convergence tolerance of the solver.
+  //! \details A non-positive value restores the tolerance of the input file.
+  virtual bool setRelTolerance(Real rtol) { forcedRTol = rtol; return true; }
+
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const;
 
+  //! \brief Replaces the preconditioner of the input file.
+  //! \param[in] p The preconditioner to use (the matrix takes ownership)
+  void setPreconditioner(ISTL::FastDiagPreconditioner* p);
+
+  //! \brief Writes the system matrix to the given output stream.
+  virtual std::ostream& write(std::ostream& os) const;
+
   //! \brief Returns the ISTL matrix (for assignment).
   virtual ISTL::Mat& getMatrix() { return iA; }
   //! \brief Returns the ISTL matrix (for read access).
@@ -158,5 +260,10 @@ protected:
   const ProcessAdm&   adm;             //!< Process administrator
   ISTLSolParams       solParams;       //!< Linear solver parameters
   bool                setParams;       //!< If linear solver parameters are set
+  Real                forcedRTol;      //!< Override of the relative tolerance
   int                 nLinSolves;      //!< Number of linear solves
+
+private:
+  //! \brief Applies the linear solver, with the overridden tolerance if any.
+  void apply(ISTL::Vec& x, ISTL::Vec& b);
 };
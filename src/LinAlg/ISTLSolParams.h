@@ -17,6 +17,7 @@
 #define _ISTL_SOLPARAMS_H
 
 #include "ISTLSupport.h"
+#include "FastDiagSolver.h"
 #include <dune/common/version.hh>
 #include <dune/istl/operators.hh>
 #include <dune/istl/solvercategory.hh>
@@ -120,6 +121,55 @@ protected:
   const DomainDecomposition& dd; //!< Domain decomposition
 };
 
+/*! This implements a fast diagonalisation preconditioner for the
+ *  (shifted) Laplace operator on a single box-shaped patch. The free
+ *  equations of the system are gathered in the nodal ordering of the patch,
+ *  solved for by the FastDiagSolver, and scattered back.
+!*/
+
+class FastDiagPreconditioner : public Preconditioner {
+public:
+#if DUNE_VERSION_NEWER(DUNE_ISTL, 2, 6)
+  Dune::SolverCategory::Category category() const
+  { return Dune::SolverCategory::sequential; }
+#else
+  // define the category
+  enum {
+    //! \brief The category the preconditioner is part of.
+    category=Dune::SolverCategory::sequential
+  };
+#endif
+
+  //! \brief Constructor
+  //! \param[in] fds_ The initialized fast diagonalisation solver
+  //! \param[in] eqs_ Equation numbers of the free nodes, in patch order
+  //! \param[in] shift_ Coefficient of the mass term
+  FastDiagPreconditioner(const FastDiagSolver& fds_,
+                         const std::vector<int>& eqs_, double shift_) :
+    fds(fds_), eqs(eqs_), shift(shift_)
+  {}
+
+  //! \brief Destructor
+  virtual ~FastDiagPreconditioner()
+  {}
+
+  //! \brief Preprocess preconditioner
+  virtual void pre(ISTL::Vec&, ISTL::Vec&) {}
+
+  //! \brief Applies the preconditioner
+  //! \param[out] v The resulting vector
+  //! \param[in] d The vector to apply the preconditioner to
+  virtual void apply(ISTL::Vec& v, const ISTL::Vec& d);
+
+  //! \brief Post-process function
+  virtual void post(ISTL::Vec&) {}
+
+protected:
+  FastDiagSolver fds; //!< The fast diagonalisation solver
+  std::vector<int> eqs; //!< Equation numbers of the free nodes
+  double shift; //!< Coefficient of the mass term
+};
+
 #ifdef HAVE_MPI
 /**
  * \brief An overlapping schwarz operator.
@@ -250,6 +300,12 @@ public:
              std::unique_ptr<ISTL::Operator>>
     setupPC(ISTL::Mat& A);
 
+  //! \brief Setup solver with a given preconditioner.
+  //! \param op Matrix adaptor to use
+  //! \param pre Preconditioner to use
+  ISTL::InverseOperator* setupSolver(ISTL::Operator& op,
+                                     ISTL::FastDiagPreconditioner& pre);
+
   //! \brief Obtain linear solver parameters.
   const LinSolParams& get() const { return solParams; }
 
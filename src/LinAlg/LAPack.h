@@ -70,6 +70,12 @@ Subroutine dposv (char uplo, int n, int nrhs,
                   Real* A, int lda, Real* B, int ldb, int& info)
 { dposv_(&uplo,&n,&nrhs,A,&lda,B,&ldb,&info); }
 
+//! \brief Computes the Cholesky factorization of a symmetric matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine dpotrf (char uplo, int n, Real* A, int lda, int& info)
+{ dpotrf_(&uplo,&n,A,&lda,&info); }
+
 //! \brief Solves the symmetric equation system \a A*x=b for prefactored \b A.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -77,6 +83,51 @@ Subroutine dpotrs (char uplo, int n, int nrhs,
                    Real* A, int lda, Real* B, int ldb, int& info)
 { dpotrs_(&uplo,&n,&nrhs,A,&lda,B,&ldb,&info); }
 
+//! \brief Computes an LU factorization of a single-precision matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine sgetrf (int m, int n, float* A, int lda, int* ipiv, int& info)
+{ sgetrf_(&m,&n,A,&lda,ipiv,&info); }
+
+//! \brief Solves \a A*x=b for a single-precision LU-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine sgetrs (char trans, int n, int nrhs,
+                   float* A, int lda, int* ipiv,
+                   float* B, int ldb, int& info)
+{ sgetrs_(&trans,&n,&nrhs,A,&lda,ipiv,B,&ldb,&info); }
+
+//! \brief Computes the Cholesky factorization of a single-precision matrix.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine spotrf (char uplo, int n, float* A, int lda, int& info)
+{ spotrf_(&uplo,&n,A,&lda,&info); }
+
+//! \brief Solves \a A*x=b for a single-precision Cholesky-factorized \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine spotrs (char uplo, int n, int nrhs,
+                   float* A, int lda, float* B, int ldb, int& info)
+{ spotrs_(&uplo,&n,&nrhs,A,&lda,B,&ldb,&info); }
+
+//! \brief Estimates the reciprocal condition number of a single-precision
+//! LU-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine sgecon (char norm, int n, const float* A, int lda,
+                   float anorm, float* rcond, float* work, int* iwork,
+                   int& info)
+{ sgecon_(&norm,&n,const_cast<float*>(A),&lda,&anorm,rcond,work,iwork,&info); }
+
+//! \brief Estimates the reciprocal condition number of a single-precision
+//! Cholesky-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+Subroutine spocon (char uplo, int n, const float* A, int lda,
+                   float anorm, float* rcond, float* work, int* iwork,
+                   int& info)
+{ spocon_(&uplo,&n,const_cast<float*>(A),&lda,&anorm,rcond,work,iwork,&info); }
+
 //! \brief Solves the standard eigenproblem \a A*x=(lambda)*x.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -128,11 +179,18 @@ Subroutine dgeev (char jobvl, char jobvr,
 #define dgetrs_ DGETRS
 #define dlange_ DLANGE
 #define dposv_  DPOSV
+#define dpotrf_ DPOTRF
 #define dpotrs_ DPOTRS
 #define dsyev_  DSYEV
 #define dsyevx_ DSYEVX
 #define dsygvx_ DSYGVX
 #define dgeev_  DGEEV
+#define sgetrf_ SGETRF
+#define sgetrs_ SGETRS
+#define spotrf_ SPOTRF
+#define spotrs_ SPOTRS
+#define sgecon_ SGECON
+#define spocon_ SPOCON
 #elif defined(_AIX)
 #define dgecon_ dgecon
 #define dgesv_  dgesv
@@ -141,11 +199,18 @@ Subroutine dgeev (char jobvl, char jobvr,
 #define dgetrs_ dgetrs
 #define dlange_ dlange
 #define dposv_  dposv
+#define dpotrf_ dpotrf
 #define dpotrs_ dpotrs
 #define dsyev_  dsyev
 #define dsyevx_ dsyevx
 #define dsygvx_ dsygvx
 #define dgeev_  dgeev
+#define sgetrf_ sgetrf
+#define sgetrs_ sgetrs
+#define spotrf_ spotrf
+#define spotrs_ spotrs
+#define sgecon_ sgecon
+#define spocon_ spocon
 #endif
 
 extern "C" {
@@ -193,12 +258,59 @@ double dlange_(const char& norm, const int& m, const int& n, const Real* A,
 void dposv_(const char& uplo, const int& n, const int& nrhs,
             Real* A, const int& lda, Real* B, const int& ldb, int& info);
 
+//! \brief Computes the Cholesky factorization of a symmetric matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void dpotrf_(const char& uplo, const int& n, Real* A, const int& lda,
+             int& info);
+
 //! \brief Solves the symmetric equation system \a A*x=b for prefactored \b A.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
 void dpotrs_(const char& uplo, const int& n, const int& nrhs,
              Real* A, const int& lda, Real* B, const int& ldb, int& info);
 
+//! \brief Computes an LU factorization of a single-precision matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void sgetrf_(const int& m, const int& n, float* A, const int& lda,
+             int* ipiv, int& info);
+
+//! \brief Solves \a A*x=b for a single-precision LU-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void sgetrs_(const char& trans, const int& n, const int& nrhs,
+             float* A, const int& lda, int* ipiv,
+             float* B, const int& ldb, int& info);
+
+//! \brief Computes the Cholesky factorization of a single-precision matrix.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void spotrf_(const char& uplo, const int& n, float* A, const int& lda,
+             int& info);
+
+//! \brief Solves \a A*x=b for a single-precision Cholesky-factorized \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void spotrs_(const char& uplo, const int& n, const int& nrhs,
+             float* A, const int& lda, float* B, const int& ldb, int& info);
+
+//! \brief Estimates the reciprocal condition number of a single-precision
+//! LU-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void sgecon_(const char& norm, const int& n, const float* A, const int& lda,
+             const float& anorm, float* rcond, float* work, int* iwork,
+             int& info);
+
+//! \brief Estimates the reciprocal condition number of a single-precision
+//! Cholesky-factorized matrix \b A.
+//! \details This is a FORTRAN-77 subroutine in the LAPack library.
+//! \sa LAPack library documentation.
+void spocon_(const char& uplo, const int& n, const float* A, const int& lda,
+             const float& anorm, float* rcond, float* work, int* iwork,
+             int& info);
+
 //! \brief Solves the standard eigenproblem \a A*x=(lambda)*x.
 //! \details This is a FORTRAN-77 subroutine in the LAPack library.
 //! \sa LAPack library documentation.
@@ -139,6 +139,11 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   virtual bool solve(const SystemVector& B, SystemVector& x, bool newLHS);
 
+  //! \brief Overrides the relative convergence tolerance of the KSP solver.
+  //! \details A non-positive value restores the tolerance of the input file.
+  //! \return \e false if a direct solver (preonly) is used
+  virtual bool setRelTolerance(Real rtol);
+
   //! \brief Solves a generalized symmetric-definite eigenproblem.
   //! \details The eigenproblem is assumed to be on the form
   //! \b A \b x = \f$\lambda\f$ \b B \b x where \b A ( = \a *this ) and \b B
@@ -194,6 +199,7 @@ protected:
   PETScSolParams      solParams;       //!< Linear solver parameters
   bool                setParams;       //!< If linear solver parameters are set
   std::string         forcedKSPType;   //!< Force a KSP type ignoring the parameters
+  Real                forcedRTol;      //!< Override of the relative tolerance
   PetscInt            ISsize;          //!< Number of index sets/elements
   PetscRealVec        coords;          //!< Coordinates of local nodes (x0,y0,z0,x1,y1,...)
   ISMat               dirIndexSet;     //!< Direction ordering
@@ -0,0 +1,112 @@
+// $Id$
+//==============================================================================
+//!
+//! \file QuasiNewton.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Low-rank quasi-Newton updates of a frozen tangent matrix.
+//!
+//==============================================================================
+
+#ifndef _QUASI_NEWTON_H
+#define _QUASI_NEWTON_H
+
+#include "MatVec.h"
+#include <deque>
+
+
+/*!
+  \brief Low-rank quasi-Newton updates of a frozen tangent matrix.
+
+  \details This class improves the search direction of modified Newton
+  iterations, where the tangent matrix \b K<sub>0</sub> is factorized once and
+  reused, by secant corrections of its inverse
+  \b H<sub>0</sub> = \b K<sub>0</sub><sup>-1</sup>.
+  The corrections are built from the iteration history
+  \b s<sub>i</sub> = \b u<sub>i+1</sub> - \b u<sub>i</sub> and
+  \b y<sub>i</sub> = \b r<sub>i</sub> - \b r<sub>i+1</sub>,
+  where \b r is the residual (out-of-balance) force vector.
+
+  The products \b H<sub>0</sub> \b y<sub>i</sub> that are needed by the updates
+  follow from the (uncorrected) modified Newton directions
+  \b H<sub>0</sub> \b r<sub>i</sub> of the previous iterations.
+  No additional equation solves are therefore needed.
+  This requires that the history is reset whenever the tangent is refactorized.
+
+  Two updates are available:
+  - BFGS, through the two-loop recursion, optionally with limited memory
+  - Broyden's second (inverse) update, which does not assume symmetry
+*/
+
+class QuasiNewton
+{
+public:
+  //! \brief Enum defining the available update methods.
+  enum Method { NONE, BFGS, BROYDEN };
+
+  //! \brief The constructor initializes the update method.
+  //! \param[in] m The update method to use
+  //! \param[in] mem Maximum number of correction pairs (0 = unlimited)
+  explicit QuasiNewton(Method m = NONE, size_t mem = 0)
+    : method(m), maxPairs(mem), havePrev(false) {}
+
+  //! \brief Defines the update method.
+  //! \param[in] m The update method to use
+  //! \param[in] mem Maximum number of correction pairs (0 = unlimited)
+  void setMethod(Method m, size_t mem = 0)
+  {
+    method = m;
+    maxPairs = mem;
+    this->reset();
+  }
+  //! \brief Returns the update method.
+  Method getMethod() const { return method; }
+
+  //! \brief Clears the iteration history, e.g., after a new tangent.
+  void reset();
+
+  //! \brief Returns the current number of correction pairs.
+  size_t size() const { return pairs.size(); }
+
+  //! \brief Updates the search direction of current iteration.
+  //! \param[in] u Current configuration
+  //! \param[in] r Residual force vector evaluated at \a u
+  //! \param d The direction \b H<sub>0</sub> \b r on input,
+  //! the quasi-Newton direction \b H \b r on output
+  //! \return \e true if a secant correction was applied to \a d
+  //!
+  //! \details The input state is stored for the next call,
+  //! and a new correction pair is formed from the previous state, if any.
+  bool update(const Vector& u, const Vector& r, Vector& d);
+
+private:
+  //! \brief Applies the BFGS corrections (two-loop recursion).
+  void bfgs(const Vector& r, const Vector& d0, Vector& d) const;
+  //! \brief Applies the Broyden corrections to \a d.
+  void broyden(const Vector& r, Vector& d) const;
+
+  //! \brief Correction pair data.
+  struct Pair
+  {
+    Vector s;   //!< Configuration increment
+    Vector y;   //!< Residual decrement, scaled by 1/y&sdot;y for Broyden
+    Vector hy;  //!< \b H<sub>0</sub> \b y (BFGS), or \b s - \b H \b y (Broyden)
+    double rho; //!< 1/(\b y&sdot;\b s) (BFGS only)
+  };
+
+  Method method;   //!< The update method
+  size_t maxPairs; //!< Maximum number of correction pairs (0 = unlimited)
+
+  std::deque<Pair> pairs; //!< Correction pairs, oldest first
+
+  bool   havePrev; //!< If \e true, the previous state below is defined
+  Vector uPrev;    //!< Previous configuration
+  Vector rPrev;    //!< Previous residual vector
+  Vector d0Prev;   //!< Previous modified Newton direction
+  Vector dPrev;    //!< Previous quasi-Newton direction
+};
+
+#endif
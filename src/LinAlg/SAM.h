@@ -72,6 +72,11 @@ public:
   //! \brief Finds the set of free DOFs coupled to each free DOF.
   bool getDofCouplings(std::vector<IntSet>& dofc) const;
 
+  //! \brief Renumbers the equations to reduce the matrix bandwidth.
+  //! \param[out] bandwidth If not null, the bandwidth before and after
+  //! \details This must be invoked before any system matrix is initialized.
+  bool renumberEquations(int* bandwidth = nullptr);
+
   //! \brief Initializes the system matrices prior to the element assembly.
   //! \param sysK   The system left-hand-side matrix to be initialized
   //! \param sysRHS The system right-hand-side load vector to be initialized
@@ -342,6 +347,7 @@ protected:
   friend class SparseMatrix;
   friend class DiagMatrix;
   friend class PETScMatrix;
+  friend class ISTLMatrix;
 };
 
 #endif
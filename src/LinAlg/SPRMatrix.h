@@ -91,6 +91,9 @@ public:
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
   virtual bool solve(SystemVector& B, bool, Real*);
+  //! \brief Solves the linear system of equations for several right-hand-sides.
+  //! \param B Right-hand-side matrix on input, solution matrix on output
+  virtual bool solve(Matrix& B, bool);
 
   //! \brief Solves a generalized symmetric-definite eigenproblem.
   //! \param B Symmetric and positive definite mass matrix.
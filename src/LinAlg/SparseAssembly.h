@@ -0,0 +1,133 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SparseAssembly.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Assembly of element matrices into sparse system matrices.
+//!
+//==============================================================================
+
+#ifndef _SPARSE_ASSEMBLY_H
+#define _SPARSE_ASSEMBLY_H
+
+#include "MatVec.h"
+
+
+/*!
+  \brief This is a C++ version of the F77 subroutine ADDEM2 (SAM library).
+  \details It performs exactly the same tasks, except that \a NRHS always is 1,
+  and that the system matrix \a SM here is any object providing an index-1
+  based element access operator, \a SM(i,j), into its sparse storage.
+  This way, the same assembly logic is used for all the sparse matrix formats,
+  also when the matrix values are stored in a third-party data structure.
+*/
+
+template<class SpMat>
+void assemSparse (const Matrix& eM, SpMat& SM, Vector& SV,
+                  const IntVec& meen, const int* meqn,
+                  const int* mpmceq, const int* mmceq, const Real* ttcc)
+{
+  // Add elements corresponding to free dofs in eM into SM
+  int i, j, ip, nedof = meen.size();
+  for (j = 1; j <= nedof; j++)
+  {
+    int jeq = meen[j-1];
+    if (jeq < 1) continue;
+
+    SM(jeq,jeq) += eM(j,j);
+
+    for (i = 1; i < j; i++)
+    {
+      int ieq = meen[i-1];
+      if (ieq < 1) continue;
+
+      SM(ieq,jeq) += eM(i,j);
+      SM(jeq,ieq) += eM(j,i);
+    }
+  }
+
+  // Add (appropriately weighted) elements corresponding to constrained
+  // (dependent and prescribed) dofs in eM into SM and/or SV
+  for (j = 1; j <= nedof; j++)
+  {
+    int jceq = -meen[j-1];
+    if (jceq < 1) continue;
+
+    int jp = mpmceq[jceq-1];
+    Real c0 = ttcc[jp-1];
+
+    // Add contributions to SV (right-hand-side)
+    if (!SV.empty())
+      for (i = 1; i <= nedof; i++)
+      {
+        int ieq = meen[i-1];
+        int iceq = -ieq;
+        if (ieq > 0)
+          SV(ieq) -= c0*eM(i,j);
+        else if (iceq > 0)
+          for (ip = mpmceq[iceq-1]; ip < mpmceq[iceq]-1; ip++)
+            if (mmceq[ip] > 0)
+            {
+              ieq = meqn[mmceq[ip]-1];
+              SV(ieq) -= c0*ttcc[ip]*eM(i,j);
+            }
+      }
+
+    // Add contributions to SM
+    for (jp = mpmceq[jceq-1]; jp < mpmceq[jceq]-1; jp++)
+      if (mmceq[jp] > 0)
+      {
+        int jeq = meqn[mmceq[jp]-1];
+        for (i = 1; i <= nedof; i++)
+        {
+          int ieq = meen[i-1];
+          int iceq = -ieq;
+          if (ieq > 0)
+          {
+            SM(ieq,jeq) += ttcc[jp]*eM(i,j);
+            SM(jeq,ieq) += ttcc[jp]*eM(j,i);
+          }
+          else if (iceq > 0)
+            for (ip = mpmceq[iceq-1]; ip < mpmceq[iceq]-1; ip++)
+              if (mmceq[ip] > 0)
+              {
+                ieq = meqn[mmceq[ip]-1];
+                SM(ieq,jeq) += ttcc[ip]*ttcc[jp]*eM(i,j);
+              }
+        }
+      }
+  }
+}
+
+
+/*!
+  \brief Adds a nodal vector into a non-symmetric rectangular sparse matrix.
+  \details The nodal values are added into the columns \a col to \a col+2.
+*/
+
+template<class SpMat>
+void assemSparse (const RealArray& V, SpMat& SM, size_t col,
+                  const IntVec& mnen, const int* meqn,
+                  const int* mpmceq, const int* mmceq, const Real*)
+{
+  for (size_t d = 0; d < mnen.size(); d++, col++)
+  {
+    Real vd = d < V.size() ? V[d] : V.back();
+    int ieq = mnen[d];
+    int ceq = -ieq;
+    if (ieq > 0)
+      SM(ieq,col) += vd;
+    else if (ceq > 0)
+      for (int ip = mpmceq[ceq-1]; ip < mpmceq[ceq]-1; ip++)
+      {
+        ieq = meqn[mmceq[ip]-1];
+        SM(ieq,col) += vd;
+      }
+  }
+}
+
+#endif
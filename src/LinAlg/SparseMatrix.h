@@ -73,6 +73,14 @@ public:
   //! \details Will preserve existing matrix content within the new dimension.
   bool redim(size_t r, size_t c);
 
+  //! \brief Toggles factorization of the matrix in single precision.
+  //! \details This is supported by the serial SuperLU solver (version 5)
+  //! only. The matrix values are then copied to single precision before the
+  //! factorization, such that the matrix itself is left untouched.
+  virtual bool setSinglePrecision(bool s);
+  //! \brief Returns \e true if the matrix is factorized in single precision.
+  virtual bool isSinglePrecision() const { return single; }
+
   //! \brief Query number of matrix rows.
   size_t rows() const { return nrow; }
   //! \brief Query number of matrix columns.
@@ -161,7 +169,8 @@ public:
   //!
   //! \details This method can be used for rectangular matrices whose rows
   //! correspond to the equation ordering og the provided \a sam object.
-  bool assembleCol(const RealArray& V, const SAM& sam, int n, size_t col);
+  virtual bool assembleCol(const RealArray& V, const SAM& sam,
+                           int n, size_t col);
 
   //! \brief Adds a scalar value into columns of a non-symmetric sparse matrix.
   //! \param[in] val The value to add for each DOF of the specified node
@@ -201,6 +210,13 @@ public:
 
   //! \brief Performs the matrix-vector multiplication \b C = \a *this * \b B.
   virtual bool multiply(const SystemVector& B, SystemVector& C) const;
+  //! \brief Performs the multi-vector multiplication \b C = \a *this * \b B.
+  //! \details The matrix is traversed only once for all columns of \b B
+  //! (once per thread for the column-oriented SuperLU format).
+  virtual bool multiply(const Matrix& B, Matrix& C) const;
+
+  //! \brief Extracts the diagonal elements of the matrix.
+  virtual bool getDiagonal(Vector& diag) const;
 
   using SystemMatrix::solve;
   //! \brief Solves the linear system of equations for a given right-hand-side.
@@ -208,6 +224,12 @@ public:
   //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
   //! \param[out] rc Reciprocal condition number of the LHS-matrix (optional)
   virtual bool solve(SystemVector& B, bool newLHS = true, Real* rc = nullptr);
+  //! \brief Solves the linear system of equations for several right-hand-sides.
+  //! \param B Right-hand-side matrix on input, solution matrix on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //! \details With SuperLU and UMFPACK, all columns are solved for using a
+  //! single factorization of the matrix.
+  virtual bool solve(Matrix& B, bool newLHS = true);
 
   //! \brief Calculate compressed-sparse-row arrays from element map.
   //! \param[out] IA Start index of each row in JA
@@ -246,6 +268,11 @@ protected:
   //! \param B Right-hand-side vector on input, solution vector on output
   //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
   bool solveSLUx(Vector& B, Real* rcond);
+  //! \brief Invokes the SuperLU equation solver in single precision.
+  //! \details This method uses the expert driver \a sgssvx.
+  //! \param B Right-hand-side vector on input, solution vector on output
+  //! \param[out] rcond Reciprocal condition number of the LHS-matrix (optional)
+  bool solveSLUs(Vector& B, Real* rcond);
 
   //! \brief Invokes the UMFPACK equation solver for a given right-hand-side.
   //! \param B Right-hand-side vector on input, solution vector on output
@@ -269,6 +296,7 @@ private:
   char editable;
 
   bool factored; //!< \e true when the matrix is factorized
+  bool single;   //!< \e true when the matrix is factorized in single precision
   size_t nrow;   //!< Number of matrix rows
   size_t ncol;   //!< Number of matrix columns
 
@@ -279,6 +307,7 @@ private:
 
 #ifdef HAS_UMFPACK
   void* umfSymbolic; //!< Symbolically factored matrix for UMFPACK
+  void* umfNumeric;  //!< Numerically factored matrix for UMFPACK
 #endif
 
 protected:
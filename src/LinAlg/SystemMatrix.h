@@ -290,6 +290,13 @@ public:
 
   //! \brief Performs a matrix-vector multiplication.
   virtual bool multiply(const SystemVector&, SystemVector&) const { return false; }
+  //! \brief Performs the multi-vector multiplication \b C = \a *this * \b B.
+  //! \details The default implementation multiplies one column at a time.
+  //! Sub-classes may override it to exploit BLAS-3 kernels or threading.
+  virtual bool multiply(const Matrix& B, Matrix& C) const;
+
+  //! \brief Extracts the diagonal elements of the matrix.
+  virtual bool getDiagonal(Vector&) const { return false; }
 
   //! \brief Solves the linear system of equations for a given right-hand-side.
   //! \param b Right-hand-side vector on input, solution vector on output
@@ -307,6 +314,30 @@ public:
     return this->solve(x.copy(b),newLHS);
   }
 
+  //! \brief Solves the linear system of equations for several right-hand-sides.
+  //! \param B Right-hand-side vectors (columns) on input, solutions on output
+  //! \param[in] newLHS \e true if the left-hand-side matrix has been updated
+  //! \details The default implementation solves for one column at a time,
+  //! reusing the factorization or preconditioner after the first column.
+  //! Sub-classes may override it to solve for all columns in one go.
+  virtual bool solve(Matrix& B, bool newLHS = true);
+
+  //! \brief Toggles factorization of the matrix in single precision.
+  //! \details The matrix is still assembled and kept in double precision,
+  //! such that residuals can be evaluated in double precision for iterative
+  //! refinement of the solution. Switching it off again releases the
+  //! single-precision factorization, if any. The factors are otherwise kept
+  //! until a new coefficient matrix is assembled.
+  //! \return \e false if single precision is not supported by this matrix
+  virtual bool setSinglePrecision(bool) { return false; }
+  //! \brief Returns \e true if the matrix is factorized in single precision.
+  virtual bool isSinglePrecision() const { return false; }
+
+  //! \brief Overrides the relative convergence tolerance of iterative solvers.
+  //! \details A non-positive value restores the tolerance of the input file.
+  //! \return \e false if the matrix is not solved by an iterative method
+  virtual bool setRelTolerance(Real) { return false; }
+
   //! \brief Returns the L-infinity norm of the matrix.
   virtual Real Linfnorm() const = 0;
 
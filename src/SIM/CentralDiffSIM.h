@@ -0,0 +1,88 @@
+// $Id$
+//==============================================================================
+//!
+//! \file CentralDiffSIM.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Explicit central difference solution driver for dynamic simulators.
+//!
+//==============================================================================
+
+#ifndef _CENTRAL_DIFF_SIM_H
+#define _CENTRAL_DIFF_SIM_H
+
+#include "NewmarkSIM.h"
+#include "DiagMatrix.h"
+
+
+/*!
+  \brief Explicit central difference solution driver for dynamic simulators.
+
+  \details This class implements the explicit Newmark method
+  (&beta; = 0, &gamma; = 0.5), which is equivalent to the central difference
+  method. The effective system matrix is then the mass matrix (plus damping),
+  which is diagonalized during the assembly. Only the mass matrix is lumped,
+  whereas the diagonal of the damping terms is used as is, such that the
+  stiffness-proportional damping is retained. Each time step therefore
+  requires one assembly of the residual forces and a diagonal scaling only,
+  and no linear equation solver is involved.
+
+  The method is conditionally stable. The critical time step size is estimated
+  from an upper bound of the largest eigenfrequency, using the element-wise
+  Gershgorin bound of the stiffness matrix relative to the lumped mass matrix.
+*/
+
+class CentralDiffSIM : public NewmarkSIM
+{
+public:
+  //! \brief The constructor initializes default solution parameters.
+  explicit CentralDiffSIM(SIMbase& sim);
+  //! \brief Empty destructor.
+  virtual ~CentralDiffSIM() {}
+
+  using NewmarkSIM::parse;
+  //! \brief Parses a data section from an XML document.
+  virtual bool parse(const TiXmlElement* elem);
+
+  //! \brief Prints out problem-specific data to the log stream.
+  virtual void printProblem() const;
+
+  //! \brief Allocates the FE system matrices.
+  //! \details The system matrix is always a diagonal (lumped) matrix.
+  //! \param[in] withRF Whether nodal reaction forces should be computed or not
+  //! \param[in] nScl Number of global scalar quantities to integrate
+  virtual bool initEqSystem(bool withRF = true, size_t nScl = 0);
+
+  //! \brief Estimates the critical time step size of the model.
+  //! \details The largest eigenfrequency is bounded by
+  //! &omega;<sub>max</sub><sup>2</sup> &le; max<sub>i</sub>
+  //! (&Sigma;<sub>e</sub>&Sigma;<sub>j</sub>|K<sup>e</sup><sub>ij</sub>|) /
+  //! M<sub>ii</sub>, where \b M is the lumped mass matrix.
+  //! This requires that the integrand supports the SIM::MASS_ONLY and
+  //! SIM::STIFF_ONLY solution modes.
+  //! \return The critical time step size 2/&omega;<sub>max</sub>,
+  //! or a negative value on failure
+  double stableTimeStep();
+
+  //! \brief Solves the dynamic equations by the central difference method.
+  //! \param param Time stepping parameters
+  //! \param[in] zero_tolerance Truncate norm values smaller than this to zero
+  //! \param[in] outPrec Number of digits after the decimal point in norm print
+  virtual SIM::ConvStatus solveStep(TimeStep& param,
+                                    SIM::SolutionMode = SIM::STATIC,
+                                    double zero_tolerance = 1.0e-8,
+                                    std::streamsize outPrec = 0);
+
+protected:
+  //! \brief Defines the lumping scheme of the system matrix, if diagonal.
+  bool setLumping(DiagMatrix::Lumping method);
+
+  DiagMatrix::Lumping lumping; //!< Mass lumping scheme
+  double safety; //!< Safety factor on the critical time step size
+  double dtCrit; //!< Estimated critical time step size
+};
+
+#endif
@@ -57,6 +57,9 @@ namespace SIM
   //! \param[in] model The isogeometric finite element model
   //! \param[in] code Property code associated with the boundary
   //! \param[out] force Global nodal force container (compressed storage)
+  //!
+  //! \details If \a force already has a node map for this boundary,
+  //! it is reused as is. Use a new container if the model is changed.
   bool initBoundaryNodeMap(SIMbase* model, int code, GlbForceVec& force);
 
   //! \brief Integrates a force integrand on a specified topology set.
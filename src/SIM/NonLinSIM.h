@@ -15,6 +15,7 @@
 #define _NON_LIN_SIM_H
 
 #include "MultiStepSIM.h"
+#include "QuasiNewton.h"
 
 
 /*!
@@ -22,6 +23,12 @@
   \details This class contains data and methods for computing the nonlinear
   solution to a quasi-static FE problem based on splines/NURBS basis functions,
   through Newton-Raphson iterations.
+
+  When the tangent matrix is kept fixed after the first \a nupdat iterations
+  (modified Newton), the search directions may be improved by BFGS or Broyden
+  updates of the factorized tangent, which require no additional solves.
+  With an iterative linear solver, the linearized equations may also be solved
+  inexactly, using Eisenstat-Walker forcing terms as the relative tolerance.
 */
 
 class NonLinSIM : public MultiStepSIM
@@ -91,6 +98,14 @@ protected:
   virtual bool updateConfiguration(TimeStep& param);
   //! \brief Performs line search to accelerate convergence.
   virtual bool lineSearch(TimeStep& param);
+  //! \brief Updates the quasi-Newton search direction, if enabled.
+  //! \param[in] newTangent If \e true, the tangent was updated
+  void quasiNewtonUpdate(bool newTangent);
+  //! \brief Updates the relative tolerance of the linear solver.
+  //! \param[in] iter Current iteration counter
+  //! \details Uses the Eisenstat-Walker forcing term (choice 2)
+  //! when inexact Newton-Krylov iterations are enabled.
+  void setForcingTerm(int iter);
 
   //! \brief Administers assembly of the linear equation system.
   //! \param[in] time Parameters for nonlinear/time-dependent simulations
@@ -124,6 +139,13 @@ protected:
   int    nupdat;  //!< Number of iterations with updated tangent
   int    prnSlow; //!< How many DOFs to print out on slow convergence
 
+  QuasiNewton qnUpd; //!< Quasi-Newton updates of the fixed tangent matrix
+
+  double etaMax;  //!< Maximum forcing term (0 = exact linear solves)
+  double etaK;    //!< Current forcing term of inexact Newton-Krylov iterations
+  double resNrm0; //!< Residual norm at the start of current step
+  double resNrmP; //!< Residual norm of the previous iteration
+
   std::map<int,int> slowNodes; //!< Nodes for which slow convergence is detected
 
 public:
@@ -104,6 +104,13 @@ protected:
   //! \param[in] whiteSpace For message formatting
   virtual ASMbase* readPatch(std::istream& isp, int pchInd, const CharVec& unf,
                              const char* whiteSpace) const;
+  //! \brief Creates a patch from given binary patch data.
+  //! \param[in] patch The patch data to create the patch from
+  //! \param[in] pchInd 0-based index of the patch
+  //! \param[in] unf Number of unknowns per basis function for each field
+  //! \param[in] whiteSpace For message formatting
+  virtual ASMbase* readPatch(const G2Patch& patch, int pchInd,
+                             const CharVec& unf, const char* whiteSpace) const;
 
 protected:
   unsigned char nf; //!< Number of scalar fields
@@ -27,6 +27,7 @@ class ForceBase;
 class AnaSol;
 class SAM;
 class AlgEqSystem;
+class StaticCondensation;
 class LinSolParams;
 class SystemMatrix;
 class SystemVector;
@@ -35,6 +36,7 @@ class RealFunc;
 class VecFunc;
 class TractionFunc;
 class ScalarFunc;
+class FastDiagSolver;
 class Vec4;
 class Vec3;
 
@@ -51,8 +53,17 @@ struct Mode
   Vector eigVec;  //!< Eigenvector associated with this mode
   Vector eqnVec;  //!< Eigenvector associated with this mode in equation order
 
+  const Matrix* shapes; //!< Common matrix owning the eigenvector, if any
+  size_t        column; //!< 1-based column index of this mode in \a shapes
+
   //! \brief Default constructor.
-  Mode() : eigNo(0), eigVal(0.0), damping(0.0) {}
+  Mode() : eigNo(0), eigVal(0.0), damping(0.0), shapes(nullptr), column(0) {}
+  //! \brief Returns the eigenvector associated with this mode.
+  //! \param buf Work vector, used if the eigenvector is stored in \a shapes
+  //! \details If the eigenvector has been moved into a common matrix of
+  //! mode shapes, its column is copied into \a buf, which then is returned.
+  //! Otherwise, \a eigVec is returned.
+  const Vector& getEigVec(Vector& buf) const;
   //! \brief Orthonormalize the eigenvector w.r.t. the given matrix.
   bool orthonormalize(const SystemMatrix& mat);
   //! \brief Compute modal damping based on the given damping matrix.
@@ -303,6 +314,47 @@ public:
   bool solveSystem(Vectors& solution, int printSol = 0,
                    const char* cmpName = "displacement");
 
+  //! \brief Solves the assembled linear system by fast diagonalisation.
+  //! \param[out] solution Global primary solution vector
+  //! \param[in] shift Coefficient of the mass term of the operator
+  //! \param[in] kappa Coefficient of the Laplace term of the operator
+  //! \param[in] idxRHS Index to the right-hand-side vector to solve for
+  //!
+  //! \details This is a direct solver for single-patch models with one unknown
+  //! per node, where the coefficient matrix is the (shifted) Laplace operator
+  //! on a box-shaped patch, see FastDiagSolver. The operator is set up from
+  //! the 1D operators of the patch and the given coefficients. The solution
+  //! is then checked against the assembled coefficient matrix, and the method
+  //! fails if the residual is not small. The fixed and prescribed nodes must
+  //! cover entire patch boundaries.
+  bool solveFastDiag(Vector& solution, double shift = 0.0, double kappa = 1.0,
+                     size_t idxRHS = 0);
+
+  //! \brief Uses fast diagonalisation as preconditioner for the linear solver.
+  //! \param[in] shift Coefficient of the mass term of the preconditioner
+  //!
+  //! \details The preconditioner is the inverse of the (shifted) Laplace
+  //! operator of the patch, see solveFastDiag(). It is applied in each
+  //! iteration of the Krylov solver, such that the assembled coefficient
+  //! matrix may deviate from it (variable coefficients, etc.).
+  //! This method must be invoked after initSystem(), and is currently
+  //! available for ISTL matrices only.
+  bool setFastDiagPreconditioner(double shift = 0.0);
+
+protected:
+  //! \brief Sets up the fast diagonalisation of the patch operators.
+  //! \param[out] fds The fast diagonalisation solver
+  //! \param[out] freeEqs Equation numbers of the free nodes, in patch order
+  bool initFastDiag(FastDiagSolver& fds, std::vector<int>& freeEqs) const;
+
+  //! \brief Improves a solution by iterative refinement.
+  //! \param[in] A The (single-precision factorized) coefficient matrix
+  //! \param[in] b The right-hand-side vector
+  //! \param x The solution vector to refine
+  bool refineSolution(SystemMatrix& A, const SystemVector& b,
+                      SystemVector& x) const;
+
+public:
   //! \brief Finds the DOFs showing the worst convergence behavior.
   //! \param[in] x Global primary solution vector
   //! \param[in] r Global residual vector associated with the solution vector
@@ -633,6 +685,10 @@ public:
   //! processor is returned. If \a patchNo is out of range, -1 is returned.
   //! If \a patchNo is not on current processor, 0 is returned.
   int getLocalPatchIndex(int patchNo) const;
+  //! \brief Returns the global patch number for the given local patch index.
+  //! \details This is the inverse of getLocalPatchIndex().
+  //! If \a idx is out of range, 0 is returned.
+  int getGlobalPatchIndex(int idx) const;
 
   //! \brief Returns a const reference to our FEM model.
   const PatchVec& getFEModel() const { return myModel; }
@@ -669,6 +725,11 @@ public:
   RealFunc* getSclFunc(int code) const;
 
 protected:
+  //! \brief Prepares the property functions for evaluation at given time.
+  //! \details This loads time-dependent function data (e.g., time levels of
+  //! HDF5-based field functions) before entering the threaded element loops.
+  bool initFunctions(double time);
+
   //! \brief Initializes material properties for integration of interior terms.
   virtual bool initMaterial(size_t) { return true; }
   //! \brief Initializes the body load properties for current patch.
@@ -691,6 +752,10 @@ protected:
   //! \param[in] silence If \e true, suppress threading group outprint
   void generateThreadGroups(const Property& p, bool silence = false);
 
+  //! \brief Fixes the element-internal nodes for static condensation.
+  //! \param[out] nodes Global numbers of the fixed internal nodes
+  void fixInternalNodes(std::vector<int>& nodes);
+
   //! \brief Adds a MADOF with an extraordinary number of DOFs on a given basis.
   //! \param[in] basis The basis to specify number of DOFs for
   //! \param[in] nndof Number of nodal DOFs on the given basis
@@ -768,6 +833,7 @@ protected:
   // Equation solver attributes
   AlgEqSystem*  myEqSys;     //!< The actual linear equation system
   SAM*          mySam;       //!< Auxiliary data for FE assembly management
+  StaticCondensation* myCondenser; //!< Condensation of element-internal DOFs
   LinSolParams* mySolParams; //!< Input parameters for PETSc
   LinSolParams* myGl2Params; //!< Input parameters for PETSc, for L2 projection
 
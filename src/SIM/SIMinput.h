@@ -19,6 +19,8 @@
 #include "Interface.h"
 
 class ModelGenerator;
+class BinaryPatchFile;
+struct G2Patch;
 
 namespace LR { struct RefineData; }
 
@@ -176,6 +178,12 @@ public:
   //! \param[in] isp The input stream to read from
   //! \param[in] whiteSpace For message formatting
   bool readPatches(std::istream& isp, const char* whiteSpace = "");
+  //! \brief Reads patches from a binary patch container.
+  //! \param[in] pchFile The patch container to read from
+  //! \param[in] whiteSpace For message formatting
+  //!
+  //! \details Only the patches owned by this process are deserialized.
+  bool readPatches(const BinaryPatchFile& pchFile, const char* whiteSpace = "");
 
   //! \brief Connects two patches.
   //! \param[in] master Master patch
@@ -205,6 +213,17 @@ protected:
   virtual ASMbase* readPatch(std::istream& isp, int pchInd,
                              const CharVec& unf = CharVec(),
                              const char* whiteSpace = "") const = 0;
+  //! \brief Creates a patch from given binary patch data.
+  //! \param[in] patch The patch data to create the patch from
+  //! \param[in] pchInd 0-based index of the patch
+  //! \param[in] unf Number of unknowns per basis function for each field
+  //! \param[in] whiteSpace For message formatting
+  //!
+  //! \details This default implementation writes the patch in g2 format to
+  //! a temporary string stream, and reads it back again.
+  virtual ASMbase* readPatch(const G2Patch& patch, int pchInd,
+                             const CharVec& unf = CharVec(),
+                             const char* whiteSpace = "") const;
 
   //! \brief Reads global node data for a patch from given input stream.
   //! \param[in] isn The input stream to read from
@@ -250,6 +269,10 @@ public:
   virtual std::vector<std::vector<int>> getElmConnectivities() const;
 
 private:
+  //! \brief Resets the number of space dimensions to the patch dimensionality.
+  //! \param[in] maxSpaceDim Largest number of space dimensions of the patches
+  void resetSpaceDim(unsigned char maxSpaceDim);
+
   //! \brief Sets initial conditions from a file.
   //! \param fieldHolder The SIM-object to inject the initial conditions into
   //! \param[in] fileName Name of file to read the initial conditions from
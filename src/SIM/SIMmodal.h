@@ -16,13 +16,15 @@
 
 #include "SIMbase.h"
 
-class ElmMats;
-
 
 /*!
   \brief Class with support for assembly of modal linear equation systems.
   \details This class contains a separate AlgEqSystem object and an associated
   SAM object, used for assembling the modal system of equations.
+  The eigenmode shapes are moved into one contiguous column-major matrix,
+  which becomes their only owner. The projection of load vectors onto the
+  modal space and the expansion of modal solutions are then performed as
+  single BLAS operations, and the diagonal modal system is solved directly.
 */
 
 class SIMmodal
@@ -38,6 +40,13 @@ protected:
   //! \param[out] pSol Dynamic solution vectors
   bool expandSolution(const Vectors& mSol, Vectors& pSol) const;
 
+  //! \brief Returns the eigenmode shapes as a matrix, one column per mode.
+  //! \details The matrix is established on the first call, by moving the
+  //! eigenvectors of the Mode objects into it. It is rebuilt only if the set
+  //! of modes is changed. A null pointer is returned if there are no modes,
+  //! or if the mode shapes have different lengths.
+  const Matrix* getModeShapes() const;
+
   //! \brief Administers assembly of the modal equation system.
   //! \param[in] time Parameters for time-dependent simulations
   //! \param[in] mSol Previous modal solution
@@ -51,6 +60,12 @@ protected:
                            double beta, double gamma,
                            double alpha1 = 0.0, double alpha2 = 0.0);
 
+  //! \brief Solves the diagonal modal equation system in closed form.
+  //! \details The equation system of the last assembleModalSystem() call is
+  //! solved directly, without using the associated AlgEqSystem object.
+  //! \param[out] mSol Modal solution vector
+  bool solveModalSystem(Vector& mSol) const;
+
   //! \brief Swaps the modal equation system before/after load vector assembly.
   bool swapSystem(AlgEqSystem*& sys, SAM*& sam);
 
@@ -77,7 +92,10 @@ protected:
 private:
   AlgEqSystem* modalSys; //!< The modal equation system
   SAM*         modalSam; //!< Auxiliary data for FE assembly management
-  ElmMats*     myElmMat; //!< Nodal (single-DOF) element matrices
+  Vector       modalLHS; //!< Diagonal coefficients of the modal system
+  Vector       modalRHS; //!< Right-hand-side vector of the modal system
+
+  mutable Matrix modeShapes; //!< Contiguous storage of the eigenmode shapes
 };
 
 #endif
@@ -73,12 +73,15 @@ public:
   int nGauss[2]; //!< Gaussian quadrature rules
 
   ASM::Discretization discretization; //!< Spatial discretization option
+  bool                condense; //!< If \e true, condense element-internal DOFs
   LinAlg::MatrixType  solver;         //!< The linear equation solver to use
 
   int num_threads_SLU; //!< Number of threads for SuperLU_MT
+  bool renumber;       //!< If \e true, use RCM ordering of the equations
+  int  mixedPrec;      //!< Max iterative refinements in mixed precision
 
   // Eigenvalue solver options
-  int    eig;   //!< Eigensolver method (1,...,5)
+  int    eig;   //!< Eigensolver method (1,...,8)
   int    nev;   //!< Number of eigenvalues/vectors
   int    ncv;   //!< Number of Arnoldi vectors
   double shift; //!< Eigenvalue shift
@@ -18,6 +18,7 @@
 #include "Vec3.h"
 
 class VTF;
+class ElementLocator;
 
 typedef std::pair<Vec3,double>  PointValue;  //!< Convenience type
 typedef std::vector<PointValue> PointValues; //!< Convenience type
@@ -315,14 +316,18 @@ protected:
   //! \brief Struct defining a result sampling point.
   struct ResultPoint
   {
-    unsigned char npar;  //!< Number of parameters
-    size_t        patch; //!< Patch index [1,nPatch]
-    int           inod;  //!< Local node number of the closest node
-    double        u[3];  //!< Parameters of the point (u,v,w)
-    Vec3          X;     //!< Spatial coordinates of the point
+    unsigned char npar;    //!< Number of parameters
+    size_t        patch;   //!< Patch index [1,nPatch]
+    int           inod;    //!< Local node number of the closest node
+    double        u[3];    //!< Parameters of the point (u,v,w)
+    Vec3          X;       //!< Spatial coordinates of the point
+    bool          spatial; //!< If \e true, the point is given by \a X
 
     //! \brief Default constructor.
-    ResultPoint() : npar(0), patch(1), inod(0) { u[0] = u[1] = u[2] = 0.0; }
+    ResultPoint() : npar(0), patch(1), inod(0), spatial(false)
+    {
+      u[0] = u[1] = u[2] = 0.0;
+    }
   };
 
   typedef std::vector<ResultPoint> ResPointVec; //!< Result point container
@@ -331,6 +336,10 @@ protected:
   //! \brief Preprocesses the result sampling points.
   virtual void preprocessResultPoints();
 
+  //! \brief Returns the spatial element locator of the model.
+  //! \details The locator is created on the first invocation.
+  const ElementLocator* getLocator();
+
   //! \brief Preprocesses a result sampling point group.
   //! \param ptFile Name of file that these result points are dumped to
   //! \param points Group of result points that are dumped to the given file
@@ -369,6 +378,8 @@ private:
   double myPtSize; //!< Size of result point visualization in VTF file
   int    myGeomID; //!< VTF geometry block ID for the first patch
   VTF*   myVtf;    //!< VTF-file for result visualization
+
+  ElementLocator* myLocator; //!< Spatial search tree over all elements
 };
 
 #endif
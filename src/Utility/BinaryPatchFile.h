@@ -0,0 +1,119 @@
+// $Id$
+//==============================================================================
+//!
+//! \file BinaryPatchFile.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Indexed binary container for spline patch geometries.
+//!
+//==============================================================================
+
+#ifndef _BINARY_PATCH_FILE_H
+#define _BINARY_PATCH_FILE_H
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+
+/*!
+  \brief Tensor-product spline patch data in GoTools representation.
+  \details The data members point into memory owned by someone else,
+  e.g., a BinaryPatchFile object or a GoTools spline object.
+*/
+
+struct G2Patch
+{
+  int  type;     //!< GoTools class type (100 = curve, 200 = surface, 700 = volume)
+  int  dim;      //!< Spatial dimension of the control points
+  bool rational; //!< If \e true, the coefficients are in homogeneous form
+  int  nDir;     //!< Number of parameter directions
+  int  n[3];     //!< Number of coefficients in each direction
+  int  order[3]; //!< Order (polynomial degree + 1) in each direction
+
+  const double* knots[3]; //!< Knot vectors, n+order values in each direction
+  const double* coefs;    //!< Control point coefficients
+
+  //! \brief Default constructor.
+  G2Patch() : type(0), dim(0), rational(false), nDir(0), coefs(nullptr)
+  {
+    for (int d = 0; d < 3; d++)
+    {
+      n[d] = order[d] = 0;
+      knots[d] = nullptr;
+    }
+  }
+
+  //! \brief Returns the total number of control points.
+  size_t nCoefs() const;
+  //! \brief Returns the total number of control point values.
+  size_t nValues() const { return this->nCoefs()*(dim + (rational ? 1 : 0)); }
+
+  //! \brief Writes the patch in GoTools ASCII (g2) format.
+  bool write(std::ostream& os) const;
+};
+
+
+/*!
+  \brief Indexed binary container for spline patch geometries.
+
+  \details The file consists of a small header, a table with the byte offset
+  of each patch record, and the patch records themselves. Each record holds
+  the integer parameters of a tensor-product spline patch followed by its
+  knot vectors and control point coefficients in binary form.
+  The file is memory-mapped when opened, such that a patch is accessed
+  without parsing, and without touching the records of the other patches.
+  This allows each process to deserialize only the patches it owns.
+
+  The container may also be assembled in memory, from g2-formatted input
+  or patch by patch, without going through any file.
+  The binary data is stored in the native byte order of the host.
+*/
+
+class BinaryPatchFile
+{
+public:
+  //! \brief Default constructor.
+  BinaryPatchFile() : mapped(nullptr), mapSize(0) {}
+  //! \brief Disable copy constructor.
+  BinaryPatchFile(const BinaryPatchFile&) = delete;
+  //! \brief The destructor releases the mapped file, if any.
+  ~BinaryPatchFile() { this->clear(); }
+
+  //! \brief Checks whether the named file is a binary patch file.
+  static bool isBinary(const char* fileName);
+
+  //! \brief Opens a binary patch file for reading.
+  bool open(const char* fileName);
+  //! \brief Loads all patches from a g2-formatted input stream.
+  //! \details Only tensor-product curves, surfaces and volumes are supported.
+  bool load(std::istream& is);
+  //! \brief Appends a patch to the container.
+  bool append(const G2Patch& patch);
+  //! \brief Writes the container to a binary patch file.
+  bool save(const char* fileName) const;
+  //! \brief Releases all data.
+  void clear();
+
+  //! \brief Returns the number of patches in the container.
+  size_t size() const { return offset.empty() ? 0 : offset.size()-1; }
+  //! \brief Returns the data of a patch in the container.
+  //! \param[in] idx 0-based patch index
+  //! \param[out] patch Patch data, pointing into the container
+  bool getPatch(size_t idx, G2Patch& patch) const;
+
+private:
+  //! \brief Returns a pointer to the first byte of the patch records.
+  const char* records() const;
+
+  std::vector<uint64_t> offset; //!< Byte offset of each patch record
+  std::vector<char>     buffer; //!< Patch records assembled in memory
+
+  char*  mapped;  //!< Memory-mapped file contents
+  size_t mapSize; //!< Size of the memory-mapped file
+};
+
+#endif
@@ -16,6 +16,8 @@
 
 #include "TensorFunction.h"
 #include <string>
+#include <list>
+#include <memory>
 
 class Field;
 class Fields;
@@ -35,15 +37,13 @@ protected:
   FieldFuncBase() : pidx(0), npch(0) {}
   //! \brief No copying of this class.
   FieldFuncBase(const FieldFuncBase&) = delete;
-  //! \brief The destructor deletes the patches.
-  virtual ~FieldFuncBase();
+  //! \brief Empty destructor.
+  virtual ~FieldFuncBase() {}
 
   //! \brief Sets the active patch.
   bool setPatch(size_t pIdx);
 
 protected:
-  std::vector<ASMbase*> patch; //!< The patches on which the field is defined
-
   size_t pidx; //!< Current patch index
   size_t npch; //!< Number of patches in the field
 };
@@ -51,10 +51,32 @@ protected:
 
 /*!
   \brief Base class for spatial functions, defined from a HDF5-file.
+  \details The field values of the time levels that have been read are kept
+  in a least-recently-used cache of bounded size. When the field is prepared
+  for a new time, the next time level is read in advance, such that the
+  subsequent time step can be served from memory. Optionally, the field values
+  can be linearly interpolated between the two time levels bracketing the
+  evaluation time.
+
+  The cached time levels are never modified after they have been read.
+  The field is defined in a number of slots, where slot 0 is the shared field
+  defined by prepare() outside the threaded loops, and slot 1+\a i is private
+  to thread \a i. The latter is used only when the function is evaluated at
+  a time it has not been prepared for.
 */
 
 class FieldFuncHDF5 : public FieldFuncBase
 {
+public:
+  //! \brief Toggles linear interpolation between the stored time levels.
+  void setInterpolation(bool interp) { linInterp = interp; }
+  //! \brief Sets the maximum number of time levels kept in the cache.
+  //! \details The levels defining the current field are kept in memory
+  //! regardless of this limit.
+  void setCacheSize(size_t nlev) { maxLevels = nlev; }
+  //! \brief Checks whether the given time level is in the cache.
+  bool isCached(int level) const;
+
 protected:
   //! \brief The constructor opens the provided HDF5-file.
   //! \param[in] fileName Name of the HDF5-file
@@ -73,22 +95,100 @@ protected:
             const std::string& basisName, int level,
             bool isScalar = false);
 
-  //! \brief Finds the level whose time is closest to the specified time.
-  int findClosestLevel(double time) const;
+  //! \brief Prepares the field for evaluation at the specified time.
+  //! \param[in] fieldNames Name of the field components in the HDF5-file
+  //! \param[in] basisName Name of the basis which the field values refer to
+  //! \param[in] time The time to evaluate the field at
+  //! \param[in] isScalar If \e true, assume this is a scalar field
+  //! \param[in] slot Index of the field slot to prepare
+  //!
+  //! \details The time levels needed are fetched from the cache, or read from
+  //! the HDF5-file if not present, and the next time level is prefetched.
+  //! The shared field (slot 0) must not be prepared while other threads are
+  //! evaluating it. The thread-private slots may be prepared by their thread.
+  bool prepare(const std::vector<std::string>& fieldNames,
+               const std::string& basisName, double time,
+               bool isScalar = false, size_t slot = 0);
+
+  //! \brief Checks whether the field is prepared for the specified time.
+  bool isPrepared(double time, size_t slot = 0) const
+  {
+    return time == slots[slot].time;
+  }
+  //! \brief Checks whether the HDF5-file contains more than one time level.
+  bool isTransient() const;
+
+  //! \brief Returns the number of field slots.
+  size_t getNoSlots() const { return slots.size(); }
+  //! \brief Returns the thread-private field slot of the calling thread.
+  static size_t threadSlot();
 
   //! \brief Adds a patch-wise field with the given coefficient values.
+  //! \param[in] slot Index of the field slot to add to
   //! \param[in] pch The patch to define the field over
   //! \param[in] coefs Field values
-  virtual void addPatchField(ASMbase* pch, const std::vector<Real>& coefs) = 0;
-  //! \brief Clears the field container.
-  virtual void clearField() = 0;
+  virtual void addPatchField(size_t slot, const ASMbase* pch,
+                             const std::vector<Real>& coefs) = 0;
+  //! \brief Clears the field container of the given slot.
+  virtual void clearField(size_t slot) = 0;
 
 private:
+  //! \brief Field values of a time level.
+  struct TimeLevel
+  {
+    int level;      //!< Time level index
+    int basisLevel; //!< Time level from which the basis is read
+    std::vector<std::shared_ptr<ASMbase>> basis; //!< Patch-wise field bases
+    std::vector<std::vector<Real>> coefs; //!< Patch-wise field values
+  };
+
+  //! \brief Shared pointer to an immutable time level.
+  typedef std::shared_ptr<const TimeLevel> LevelPtr;
+
+  //! \brief Definition of the field in one slot.
+  struct Slot
+  {
+    LevelPtr level[2]; //!< Time levels defining the field
+    double   theta;    //!< Interpolation weight of \a level[1]
+    double   time;     //!< The time the field is prepared for
+  };
+
+  //! \brief Returns the time of the given level.
+  //! \return \e false if the level does not exist in the HDF5-file
+  bool getLevelTime(int level, double& time) const;
+  //! \brief Finds the level whose time is closest to the specified time.
+  int findClosestLevel(double time) const;
+  //! \brief Finds the latest level at or before \a level with a basis.
+  int findBasisLevel(const std::string& basisName, int level) const;
+
+  //! \brief Finds the time levels needed for evaluation at given time.
+  //! \details This method updates the cache and must be invoked within the
+  //! critical section \a FieldFuncHDF5 only.
+  bool update(const std::vector<std::string>& fieldNames,
+              const std::string& basisName, double time,
+              bool isScalar, Slot& s, bool& changed);
+  //! \brief Returns the given time level, reading it from file if needed.
+  LevelPtr getLevel(const std::vector<std::string>& fieldNames,
+                    const std::string& basisName, int level,
+                    bool isScalar);
+  //! \brief Reads field values for the specified time level from file.
+  bool readLevel(const std::vector<std::string>& fieldNames,
+                 const std::string& basisName, TimeLevel& data,
+                 bool isScalar);
+  //! \brief Defines the field of a slot from its time levels.
+  void activate(size_t slot);
+
   HDF5Reader* hdf5; //!< The HDF5-file containing the field data
   ProcessAdm* pAdm; //!< Process administrator for the HDF5-file reader
 
-  mutable int    lastLevel; //!< The last time level read from
-  mutable double lastTime;  //!< The time of \a lastLevel
+  mutable int    lastLevel; //!< The last time level found
+  mutable std::vector<Real> levelTime; //!< Times of the levels found so far
+
+  std::list<LevelPtr> cache; //!< Loaded time levels, most recent used first
+  size_t maxLevels; //!< Maximum number of time levels in the cache
+  bool   linInterp; //!< If \e true, interpolate linearly between time levels
+
+  std::vector<Slot> slots; //!< Field definitions, shared and thread-private
 };
 
 
@@ -109,29 +209,41 @@ public:
                 const std::string& fieldName,
                 int level = 0);
   //! \brief The destructor deletes the scalar fields.
-  virtual ~FieldFunction() { this->clearField(); }
+  virtual ~FieldFunction();
+
+  using FieldFuncHDF5::setInterpolation;
+  using FieldFuncHDF5::setCacheSize;
+  using FieldFuncHDF5::isCached;
+
+  //! \brief Returns whether the function is time-independent or not.
+  virtual bool isConstant() const { return !this->isTransient(); }
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the time level(s) needed for evaluation at time \a t.
+  virtual bool initTime(double t)
+  {
+    return this->prepare({fName},bName,t,true);
+  }
 
 protected:
   //! \brief Evaluates the scalar field function.
   virtual Real evaluate(const Vec3& X) const;
 
   //! \brief Adds a patch-wise field with the given coefficient values.
+  //! \param[in] slot Index of the field slot to add to
   //! \param[in] pch The patch to define the field over
   //! \param[in] coefs Field values
-  virtual void addPatchField(ASMbase* pch, const std::vector<Real>& coefs);
-  //! \brief Clears the field container.
-  virtual void clearField();
+  virtual void addPatchField(size_t slot, const ASMbase* pch,
+                             const std::vector<Real>& coefs);
+  //! \brief Clears the field container of the given slot.
+  virtual void clearField(size_t slot);
 
 private:
-  mutable int currentLevel; //!< Current time level to evaluate at
-
   std::string fName; //!< Name of field
   std::string bName; //!< Name of basis
 
-  std::vector<Field*> field; //!< The scalar field to be evaluated
+  std::vector<std::vector<Field*>> field; //!< The scalar field of each slot
 };
 
 
@@ -179,26 +291,30 @@ protected:
                  const std::string& fieldName,
                  int level);
   //! \brief The destructor deletes the vector fields.
-  virtual ~FieldsFuncBase() { this->clearField(); }
+  virtual ~FieldsFuncBase();
 
   //! \brief Adds a patch-wise field with the given coefficient values.
+  //! \param[in] slot Index of the field slot to add to
   //! \param[in] pch The patch to define the field over
   //! \param[in] coefs Field values
-  virtual void addPatchField(ASMbase* pch, const std::vector<Real>& coefs);
-  //! \brief Clears the field container.
-  virtual void clearField();
+  virtual void addPatchField(size_t slot, const ASMbase* pch,
+                             const std::vector<Real>& coefs);
+  //! \brief Clears the field container of the given slot.
+  virtual void clearField(size_t slot);
+
+  //! \brief Loads the time level(s) needed for evaluation at time \a t.
+  bool prepareTime(double t, size_t slot = 0)
+  {
+    return this->prepare(fName,bName,t,false,slot);
+  }
 
   //! \brief Evaluates the field at the givent point \b X.
   std::vector<Real> getValues(const Vec3& X);
 
-private:
-  mutable int currentLevel; //!< Current time level to evaluate at
-
-protected:
   std::vector<std::string> fName; //!< Name of field components
   std::string              bName; //!< Name of basis
 
-  std::vector<Fields*> field; //!< The vector field to be evaluated
+  std::vector<std::vector<Fields*>> field; //!< The vector field of each slot
 };
 
 
@@ -221,8 +337,17 @@ public:
   //! \brief Empty destructor.
   virtual ~VecFieldFunction() {}
 
+  using FieldsFuncBase::setInterpolation;
+  using FieldsFuncBase::setCacheSize;
+  using FieldsFuncBase::isCached;
+
+  //! \brief Returns whether the function is time-independent or not.
+  virtual bool isConstant() const { return !this->isTransient(); }
+
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the time level(s) needed for evaluation at time \a t.
+  virtual bool initTime(double t) { return this->prepareTime(t); }
 
 protected:
   //! \brief Evaluates the vectorial field function.
@@ -249,8 +374,17 @@ public:
   //! \brief Empty destructor.
   virtual ~TensorFieldFunction() {}
 
+  using FieldsFuncBase::setInterpolation;
+  using FieldsFuncBase::setCacheSize;
+  using FieldsFuncBase::isCached;
+
+  //! \brief Returns whether the function is time-independent or not.
+  virtual bool isConstant() const { return !this->isTransient(); }
+
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the time level(s) needed for evaluation at time \a t.
+  virtual bool initTime(double t) { return this->prepareTime(t); }
 
 protected:
   //! \brief Evaluates the tensorial field function.
@@ -277,8 +411,17 @@ public:
   //! \brief Empty destructor.
   virtual ~STensorFieldFunction() {}
 
+  using FieldsFuncBase::setInterpolation;
+  using FieldsFuncBase::setCacheSize;
+  using FieldsFuncBase::isCached;
+
+  //! \brief Returns whether the function is time-independent or not.
+  virtual bool isConstant() const { return !this->isTransient(); }
+
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t pIdx) { return this->setPatch(pIdx); }
+  //! \brief Loads the time level(s) needed for evaluation at time \a t.
+  virtual bool initTime(double t) { return this->prepareTime(t); }
 
 protected:
   //! \brief Evaluates the tensorial field function.
@@ -164,6 +164,10 @@ public:
 
   //! \brief Sets the active patch.
   virtual bool initPatch(size_t) { return true; }
+  //! \brief Prepares the function for evaluation at the given time.
+  //! \details This method is invoked before the (possibly multi-threaded)
+  //! integration loops, such that time-dependent data can be set up once.
+  virtual bool initTime(double) { return true; }
 
   //! \brief Checks if a specified point is within the function domain.
   virtual bool inDomain(const Vec3&) const { return true; }
@@ -17,6 +17,8 @@
 
 /*!
   \brief Gaussian quadrature rules in one dimension.
+  \details The rules with up to 10 points are tabulated. The rules with
+  11 to 50 points are all computed the first time one of them is requested.
 */
 
 class GaussQuadrature
@@ -23,12 +23,17 @@ namespace Legendre
   //! \param[out] weights Computed Gauss-Legendre weight
   //! \param[out] points Computed Gauss-Legendre points
   //! \param[in] n Number of Gauss points
+  //!
+  //! \details The rule is computed on the first request only, and is then
+  //! fetched from an internal cache on subsequent requests.
   bool GL(std::vector<Real>& weights, std::vector<Real>& points, int n);
 
   //! \brief Get Gauss-Lobatto-Legendre points and weights in the domain [-1,1].
   //! \param[out] weights Computed Gauss-Legendre weight
   //! \param[out] points Computed Gauss-Legendre points
   //! \param[in] n Number of Gauss points
+  //!
+  //! \details The rule is cached in the same manner as for GL().
   bool GLL(std::vector<Real>& weights, std::vector<Real>& points, int n);
 
   //! \brief Evaluates the \a n-th Legendre polynomial.
@@ -48,6 +53,15 @@ namespace Legendre
   //! \param[in] n Number of GLL points/polynomials
   //! \param[out] der Evaluated values
   bool basisDerivatives(int n, utl::matrix<Real>& der);
+
+  //! \brief Establishes the 1D stiffness and mass matrices of a spectral
+  //! element discretization using \a n GLL points in each element.
+  //! \param[in] n Number of GLL points/polynomials per element
+  //! \param[in] h Physical length of each element
+  //! \param[out] K Stiffness matrix
+  //! \param[out] M Mass matrix, which is diagonal due to GLL integration
+  bool operators(int n, const std::vector<Real>& h,
+                 utl::matrix<Real>& K, utl::matrix<Real>& M);
 }
 
 #endif
@@ -0,0 +1,87 @@
+// $Id$
+//==============================================================================
+//!
+//! \file SplineProjector.h
+//!
+//! \date Oct 18 2026
+//!
+//! \author Knut Morten Okstad / SINTEF
+//!
+//! \brief Repeated projection of spatial functions onto a fixed spline basis.
+//!
+//==============================================================================
+
+#ifndef _SPLINE_PROJECTOR_H
+#define _SPLINE_PROJECTOR_H
+
+#include "DenseMatrix.h"
+#include "Vec3.h"
+
+class FunctionBase;
+
+namespace Go {
+  class BsplineBasis;
+  class SplineCurve;
+  class SplineSurface;
+}
+
+
+/*!
+  \brief Class for repeated projection of spatial functions onto a spline.
+
+  \details This class computes the same control point values as
+  SplineUtils::project(), i.e., it interpolates the function at the Greville
+  points of the spline basis. The Cartesian coordinates of the sampling
+  points and the collocation matrices are computed once, in the constructor.
+  The collocation matrices are factorized on the first projection, such that
+  each subsequent projection only amounts to evaluating the function at the
+  sampling points followed by back-substitutions. A surface is handled as
+  the tensor product of its two univariate bases.
+
+  Each instance must be used by one thread only, but different instances
+  may be used concurrently, since the spline object is not accessed
+  after construction.
+*/
+
+class SplineProjector
+{
+public:
+  //! \brief Constructor for projection onto a spline curve.
+  explicit SplineProjector(const Go::SplineCurve& curve);
+  //! \brief Constructor for projection onto a spline surface.
+  explicit SplineProjector(const Go::SplineSurface& surf);
+  //! \brief Empty destructor.
+  virtual ~SplineProjector() {}
+
+  //! \brief Returns the number of control points of the spline.
+  size_t size() const { return X.size(); }
+
+  //! \brief Projects a spatial function onto the spline basis.
+  //! \param[in] f The function to project
+  //! \param[out] coefs Control point values, \a nComp values per point
+  //! \param[in] nComp Number of function components to project
+  //! \param[in] time Current time
+  //!
+  //! \details The control point values are ordered as the coefficients of
+  //! the spline object returned by SplineUtils::project(). For rational
+  //! splines, the values are with respect to the weights of the input spline.
+  bool project(const FunctionBase& f, RealArray& coefs,
+               int nComp = 1, Real time = Real(0));
+
+private:
+  //! \brief Establishes the collocation matrix of a univariate basis.
+  static bool collocation(const Go::BsplineBasis& basis, DenseMatrix& A,
+                          RealArray& par);
+
+  std::vector<Vec4> X; //!< Cartesian coordinates of the sampling points
+  RealArray         W; //!< Weight function values at the sampling points
+  RealArray         w; //!< Control point weights (for rational splines only)
+
+  size_t      nu; //!< Number of control points in first parameter direction
+  size_t      nv; //!< Number of control points in second parameter direction
+  DenseMatrix Au; //!< Collocation matrix in first parameter direction
+  DenseMatrix Av; //!< Collocation matrix in second parameter direction
+  bool        ok; //!< If \e false, the projector could not be established
+};
+
+#endif
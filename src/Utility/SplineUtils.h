@@ -17,14 +17,18 @@
 #include "MatVec.h"
 
 class FunctionBase;
+struct G2Patch;
 class Vec4;
 class Vec3;
 
 namespace Go {
   class Point;
+  class BsplineBasis;
+  struct BasisPtsSf;
   struct BasisDerivsSf;
   struct BasisDerivsSf2;
   struct BasisDerivsSf3;
+  struct BasisPts;
   struct BasisDerivs;
   struct BasisDerivs2;
   class SplineCurve;
@@ -41,11 +45,73 @@ namespace SplineUtils //! Various utility functions on spline objects.
   Vec4 toVec4(const Go::Point& X, Real time = Real(0));
 
   //! \brief Evaluates given spline curve at a parametric point.
-  void point(Vec3& X, double u, Go::SplineCurve* curve);
+  void point(Vec3& X, double u, const Go::SplineCurve* curve);
   //! \brief Evaluates given spline surface at a parametric point.
-  void point(Vec3& X, double u, double v, Go::SplineSurface* surf);
+  void point(Vec3& X, double u, double v, const Go::SplineSurface* surf);
   //! \brief Evaluates given spline colume at a parametric point.
-  void point(Vec3& X, double u, double v, double w, Go::SplineVolume* vol);
+  void point(Vec3& X, double u, double v, double w,
+             const Go::SplineVolume* vol);
+
+  //! \brief Returns the index of the knot span containing a parameter value.
+  //! \details Unlike Go::BsplineBasis::knotInterval(), this function does not
+  //! cache the last found interval, and is therefore thread safe.
+  //! The last non-empty knot span is returned at the end of the domain.
+  int findKnotSpan(const Go::BsplineBasis& basis, double u);
+
+  //! \brief Evaluates the non-zero basis functions of a B-spline basis.
+  //! \param[in] basis The univariate spline basis
+  //! \param[in] u The parameter value to evaluate at
+  //! \param[in] nder Number of derivatives to evaluate (at most 3)
+  //! \param[out] ders Values and derivatives of the \a order non-zero basis
+  //! functions, ders[i*(nder+1)+k] is the k'th derivative of function \a i.
+  //! This is the same layout as Go::BsplineBasis::computeBasisValues().
+  //! \return Index of the knot span containing \a u, negative on error
+  //!
+  //! \details This is a thread-safe implementation of the Cox-de Boor
+  //! recursion, writing into the caller-provided array without allocations.
+  int evalBasis(const Go::BsplineBasis& basis, double u, int nder,
+                double* ders);
+
+  //! \brief Establishes the 1D stiffness and mass matrices of a B-spline basis.
+  //! \param[in] basis The univariate spline basis
+  //! \param[in] length Physical length of the parameter domain
+  //! \param[out] K Stiffness matrix \f$\int N_{i,x}N_{j,x}\,dx\f$
+  //! \param[out] M Mass matrix \f$\int N_iN_j\,dx\f$
+  //!
+  //! \details The parameter domain is assumed to be mapped affinely onto
+  //! an interval of the given length.
+  bool getOperators(const Go::BsplineBasis& basis, double length,
+                    Matrix& K, Matrix& M);
+
+  //! \brief Evaluates the basis functions and derivatives of a spline curve.
+  //! \details Thread-safe alternative to Go::SplineCurve::computeBasis().
+  //! \return Index of the knot span containing \a u, negative on error
+  int computeBasis(const Go::SplineCurve& curve, double u, RealArray& N,
+                   RealArray* dNdu = nullptr, RealArray* d2Ndu2 = nullptr);
+  //! \brief Evaluates the basis functions of a spline surface.
+  //! \details Thread-safe alternative to Go::SplineSurface::computeBasis().
+  bool computeBasis(const Go::SplineSurface& surf, double u, double v,
+                    Go::BasisPtsSf& spline);
+  //! \brief Evaluates the basis functions and 1st derivatives of a surface.
+  //! \details Thread-safe alternative to Go::SplineSurface::computeBasis().
+  bool computeBasis(const Go::SplineSurface& surf, double u, double v,
+                    Go::BasisDerivsSf& spline);
+  //! \brief Evaluates the basis functions, 1st and 2nd derivatives of a surface.
+  //! \details Thread-safe alternative to Go::SplineSurface::computeBasis().
+  bool computeBasis(const Go::SplineSurface& surf, double u, double v,
+                    Go::BasisDerivsSf2& spline);
+  //! \brief Evaluates the basis functions of a spline volume.
+  //! \details Thread-safe alternative to Go::SplineVolume::computeBasis().
+  bool computeBasis(const Go::SplineVolume& vol, double u, double v, double w,
+                    Go::BasisPts& spline);
+  //! \brief Evaluates the basis functions and 1st derivatives of a volume.
+  //! \details Thread-safe alternative to Go::SplineVolume::computeBasis().
+  bool computeBasis(const Go::SplineVolume& vol, double u, double v, double w,
+                    Go::BasisDerivs& spline);
+  //! \brief Evaluates the basis functions, 1st and 2nd derivatives of a volume.
+  //! \details Thread-safe alternative to Go::SplineVolume::computeBasis().
+  bool computeBasis(const Go::SplineVolume& vol, double u, double v, double w,
+                    Go::BasisDerivs2& spline);
 
   //! \brief Establishes matrices with basis functions and 1st derivatives.
   void extractBasis(const Go::BasisDerivsSf& spline,
@@ -84,6 +150,13 @@ namespace SplineUtils //! Various utility functions on spline objects.
   //! \brief Builds a knot vector from a given polynomial order, knots and continuities.
   std::vector<double> buildKnotVector(int p, const std::vector<double>& simple_knots,
                                       const std::vector<int>& continuities);
+
+  //! \brief Returns binary patch data referring to a spline curve.
+  G2Patch toG2Patch(const Go::SplineCurve& curve);
+  //! \brief Returns binary patch data referring to a spline surface.
+  G2Patch toG2Patch(const Go::SplineSurface& surface);
+  //! \brief Returns binary patch data referring to a spline volume.
+  G2Patch toG2Patch(const Go::SplineVolume& volume);
 }
 
 #endif
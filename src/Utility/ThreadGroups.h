@@ -16,10 +16,25 @@
 
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 
 
 /*!
   \brief Class containing threading group partitioning.
+
+  \details The elements are split into stripes along one parameter direction,
+  where every second stripe belongs to the first group and the others to the
+  second group. Each stripe is processed by one thread, and the stripes within
+  a group do not share any nodes. By default, the stripes contain an equal
+  number of (non-zero) element layers. If element costs are available,
+  the stripe widths are instead chosen such that the stripes have roughly
+  equal total cost. The costs may be given explicitly, or be measured during
+  an assembly and then be used to rebalance the stripes for the next one.
+
+  The stripes of a group are processed with the OpenMP runtime schedule,
+  which is set once by the command-line option -schedule, or otherwise by the
+  OMP_SCHEDULE environment variable. With a dynamic or guided schedule,
+  it may be beneficial to use more stripes than threads, see \a nStripes.
 */
 
 class ThreadGroups
@@ -31,9 +46,30 @@ class ThreadGroups
 public:
   //! Directions to consider for element stripes.
   enum StripDirection { U, V, W, ANY };
+  //! Loop scheduling to use within a group.
+  enum Schedule { STATIC, DYNAMIC, GUIDED };
+
+  /*!
+    \brief Class measuring the assembly time of an element.
+    \details The elapsed time between the construction and destruction of an
+    object of this class is added to the cost of the specified element.
+  */
+  class Timer
+  {
+  public:
+    //! \brief The constructor starts the timer.
+    //! \param group The thread groups to update the cost for (may be null)
+    //! \param[in] iel 0-based element index
+    Timer(ThreadGroups* group, int iel);
+    //! \brief The destructor stops the timer and updates the element cost.
+    ~Timer();
+  private:
+    double* cost; //!< Pointer to the element cost
+    double  t0;   //!< Start time
+  };
 
   //! \brief Default constructor.
-  explicit ThreadGroups(StripDirection dir = ANY) : stripDir(dir) {}
+  explicit ThreadGroups(StripDirection dir = ANY) : stripDir(dir), pDeg{} {}
 
   //! \brief Calculates a 2D thread group partitioning based on stripes.
   //! \param[in] el1 Flags non-zero knot spans in first parameter direction
@@ -73,6 +109,18 @@ public:
   //! \brief Maps a partitioning through a map.
   //! \details The original entry \a n in the group is mapped onto \a map[n].
   void applyMap(const IntVec& map);
+  //! \brief Sorts the elements within each stripe by increasing key value.
+  //! \param[in] key Sort key of each element
+  void sortStripes(const std::vector<uint64_t>& key);
+  //! \brief Sorts the elements within each stripe along a Morton curve.
+  //! \param[in] nel1 Number of elements in the first direction
+  //! \param[in] nel2 Number of elements in the second direction
+  //! \param[in] nel3 Number of elements in the third direction
+  void sortMorton(size_t nel1, size_t nel2, size_t nel3 = 1);
+  //! \brief Returns the Morton (Z-order) key of a cell in a 3D grid.
+  //! \details The key is obtained by interleaving the bits of the three
+  //! cell indices, of which only the 21 least significant bits are used.
+  static uint64_t mortonKey(unsigned int i, unsigned int j, unsigned int k);
 
   //! \brief Returns the number of groups.
   size_t size() const { return tg[1].empty() ? 1 : 2; }
@@ -87,6 +135,24 @@ public:
   //! \param[in] elmList The white list of elements
   ThreadGroups filter(const IntVec& elmList) const;
 
+  //! \brief Defines the assembly cost of each element.
+  //! \details The costs are used by subsequent invocations of the calcGroups()
+  //! methods taking knot-span flags as argument.
+  void setElementCosts(const std::vector<double>& cost) { elmCost = cost; }
+  //! \brief Returns the (measured) assembly cost of each element.
+  const std::vector<double>& getElementCosts() const { return elmCost; }
+
+  //! \brief Prepares for measuring the element costs during an assembly.
+  //! \return \e true if the costs should be measured, otherwise \e false
+  bool startMeasuring();
+  //! \brief Recalculates the groups based on the measured element costs.
+  //! \return \e true if the groups were recalculated, otherwise \e false
+  bool rebalance();
+
+  //! \brief Sets the OpenMP runtime schedule to use within a group.
+  //! \details This is invoked when parsing the command-line options.
+  static void applySchedule();
+
 protected:
   //! \brief Calculates the parameter direction of the treading stripes in 2D.
   static StripDirection getStripDirection(int nel1, int nel2,
@@ -98,11 +164,45 @@ protected:
   //! \brief Prints out a threading group definition.
   static void printGroup(const IntMat& group, int g);
 
+  //! \brief Sums the element costs over element layers in the strip direction.
+  //! \param[in] nel1 Number of elements in the first direction
+  //! \param[in] nel2 Number of elements in the second direction
+  //! \param[in] nel3 Number of elements in the third direction
+  std::vector<double> layerCosts(size_t nel1, size_t nel2,
+                                 size_t nel3 = 1) const;
+  //! \brief Calculates stripe widths with roughly equal costs.
+  //! \param[in] cost Cost of each element layer in the strip direction
+  //! \param[in] elz Flags non-zero knot spans in the strip direction
+  //! \param[in] threads Number of stripes in each group
+  //! \param[in] minsize Minimum number of non-zero element layers per stripe
+  //! \param[out] stripsizes Number of element layers in each stripe
+  //! \return \e false if the total cost is zero, otherwise \e true
+  static bool costStripes(const std::vector<double>& cost, const BoolVec& elz,
+                          int threads, int minsize, IntVec* stripsizes);
+  //! \brief Calculates stripe widths with equal number of non-zero layers.
+  //! \param[in] elz Flags non-zero knot spans in the strip direction
+  //! \param[in] threads Number of stripes in each group
+  //! \param[in] stripsize Number of non-zero element layers per stripe
+  //! \param[in] remainder Number of stripes with one additional layer
+  //! \param[out] stripsizes Number of element layers in each stripe
+  static void equalStripes(const BoolVec& elz, int threads,
+                           int stripsize, int remainder, IntVec* stripsizes);
+
 public:
   StripDirection stripDir; //!< Actual direction to split elements
 
+  static bool     balance;  //!< If \e true, measure and balance element costs
+  static int      nStripes; //!< Number of stripes per thread in each group
+  static Schedule schedule; //!< Loop scheduling to use within a group
+  static bool     zOrder;   //!< If \e true, sort the stripes in Z-order
+
 private:
   IntMat tg[2]; //!< Threading groups (always two, but the second may be empty)
+
+  std::vector<double> elmCost; //!< Assembly cost of each element
+
+  std::vector<BoolVec> spans; //!< Non-zero knot span flags of last calcGroups
+  int pDeg[3]; //!< Polynomial degrees of last calcGroups
 };
 
 #endif